@@ -25,12 +25,37 @@
 *****************************************************/
 #include <string.h>
 #include <stdlib.h>
+#ifdef ST7565R_FRAME_HANDOFF
+#include <stdatomic.h>
+#endif
 
 #include "ST7565R.h"
 #include "bitmaps.h"
+#if defined(__has_include)					// Fonts are used if they're there, in Fonts/ or next to the driver
+#if __has_include("Fonts/crcFont.h")
 #include "Fonts/crcFont.h"
+#elif __has_include("crcFont.h")
+#include "crcFont.h"
+#endif
+#if __has_include("Fonts/crcPropFont.h")
+#include "Fonts/crcPropFont.h"
+#elif __has_include("crcPropFont.h")
+#include "crcPropFont.h"
+#endif
+#if __has_include("Fonts/flowFont.h")
 #include "Fonts/flowFont.h"
+#elif __has_include("flowFont.h")
+#include "flowFont.h"
+#endif
+#if __has_include("Fonts/kleinFont.h")
 #include "Fonts/kleinFont.h"
+#elif __has_include("kleinFont.h")
+#include "kleinFont.h"
+#endif
+#else
+#include "crcFont.h"
+#include "crcPropFont.h"
+#endif
 
 
 /****************************************************
@@ -58,19 +83,256 @@ const ST7565R_STM_Pin NHD_SCL = {.port = NHD_SCL_GPIO_Port, .pin = NHD_SCL_Pin};
 *        DRIVER VARIABLES & DATA STRUCTURES         *
 ****************************************************/
 
-#ifndef PAINT_IMMEDIATELY
+#if !defined(PAINT_IMMEDIATELY) && !defined(ST7565R_STRIP_MODE)
 static uint8_t* lastScreen;
 #endif
 static uint8_t* curScreen;
+static uint8_t* target;						// Where the rasterizers draw: curScreen, or a strip of pages starting at targetFirstPage
+static int targetFirstPage = 0;
 static ST7565R_Font curFont;
+static bool asleep = false;					// Between ST7565R_sleep() and ST7565R_wake(), DISPLAY_ON is held back
+static ST7565R_Viewport viewport = {		// Current clip rectangle and origin, pixels outside the clip are never rasterized
+	.left = 0, .top = 0, .right = DRAWWIDTH, .bottom = DRAWHEIGHT, .originX = 0, .originY = 0
+};
+static ST7565R_Viewport viewportStack[ST7565R_CLIP_STACK_DEPTH];
+static uint8_t viewportDepth = 0;
+static ST7565R_Viewport* renderClip = &viewport;	// What the rasterizers clip to and draw with. The caller's viewport and font,
+static const ST7565R_Font* renderFont = &curFont;	// except while runDisplayList() draws the queued commands
+static int16_t drawableTop = 0;					// Rows no clip can reach past: the whole screen, or in strip mode the page being drawn
+static int16_t drawableBottom = DRAWHEIGHT;
+static uint16_t dirtyStart[SCREENPAGES];		// First column of each page that may differ from lastScreen
+static uint16_t dirtyEnd[SCREENPAGES];			// One past the last such column, dirtyStart == dirtyEnd means clean
+static uint32_t dirtyStamp[SCREENPAGES];		// dirtyClock when each page was last marked, budgeted updates send the newest first
+static uint32_t dirtyClock = 0;
+static ST7565R_FlushStats flushStats = {0};		// See ST7565R_getFlushStats()
+#ifdef ST7565R_SCRUB
+static uint8_t scrubPage = 0;					// Where the next ST7565R_scrubTick() starts
+static uint8_t scrubColumn = 0;
+#endif
+static const char numberChars[] = "0123456789-. ";	// Characters in the digit strip, in strip order
+static const uint32_t powersOf10[] = {1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1};
+static uint8_t digitStrip[ST7565R_DIGIT_STRIP_BYTES];	// numberChars painted in the current font, vertically oriented, one cell after another
+static const void* digitStripFont = NULL;		// Font the strip was built from, see ST7565R_fontIdentity()
+static uint8_t digitStripWidth = 0;				// Columns per character
+static bool digitStripFits = false;				// Otherwise characters are painted straight from the font
+static ST7565R_NumberCache numberCache[ST7565R_NUMBER_CACHE_SIZE];
+static uint8_t numberCacheNext = 0;				// Entry reused next when a number is painted somewhere new
+static const ST7565R_NumberCache* numberBeingPainted = NULL;	// Its own painting doesn't make it forget itself
+#ifdef ST7565R_DISPLAY_LIST
+static ST7565R_Command displayList[ST7565R_DISPLAY_LIST_SIZE];	// Ring buffer, commands from listTail up to listHead get drawn next update
+static volatile uint8_t listHead = 0;
+static volatile uint8_t listTail = 0;
+static ST7565R_Font listFonts[ST7565R_DISPLAY_LIST_FONTS];		// Fonts the queued commands use
+static uint8_t listNumFonts = 0;
+static uint16_t listDropped = 0;				// Commands lost to a full list, see ST7565R_displayListDropped()
+static uint8_t pageStrip[SCREENWIDTH];			// The page being drawn
+#endif
+static ST7565R_LockHook lockHook = NULL;		// Mutex hooks, see ST7565R_setLockHooks()
+static ST7565R_LockHook unlockHook = NULL;
+static void* lockContext = NULL;
+#if defined(ST7565R_GRAYSCALE) || defined(ST7565R_SCRUB)
+static volatile uint8_t lockDepth = 0;			// ST7565R_lock() calls not unlocked yet, a tick from a timer skips while there are any
+#endif
+#ifdef ST7565R_TRACE
+static ST7565R_TraceSink traceSink = NULL;
+static void* traceContext = NULL;
+static uint8_t traceBuffer[ST7565R_TRACE_BUFFER];	// Records waiting for the sink
+static uint16_t traceUsed = 0;
+static uint32_t traceLast = 0;					// ST7565R_trace_clock() at the last Chip Select falling edge
+#endif
+#ifdef ST7565R_TILE_MAP
+static const uint8_t* tileset = NULL;
+static uint8_t tilesetCount = 0;
+static uint8_t tileMap[SCREENPAGES][ST7565R_TILE_COLUMNS];			// Tile shown in each cell
+static uint8_t tileDirty[SCREENPAGES][(ST7565R_TILE_COLUMNS + 7) / 8];	// Cells changed since they were last copied in, a bit each
+#endif
+#ifdef ST7565R_SPRITES
+static ST7565R_Sprite* spriteList = NULL;		// Bottom sprite first
+static uint8_t spritePage[SCREENWIDTH];			// A page of curScreen with the sprites on top, what actually gets sent
+#endif
+static volatile ST7565R_Backlight backlight;		// Shared with the timer interrupt, change it inside a critical section
+static const uint16_t backlightGamma[101] = {		// Brightness 0 - 100 to PWM duty 0 - 65535, gamma 2.2 so equal steps look equal
+	0, 3, 12, 29, 55, 90, 134, 189, 253, 328,
+	413, 510, 618, 736, 867, 1009, 1163, 1329, 1507, 1697,
+	1900, 2115, 2343, 2584, 2838, 3104, 3384, 3677, 3983, 4303,
+	4636, 4983, 5343, 5717, 6106, 6508, 6924, 7354, 7798, 8257,
+	8730, 9217, 9719, 10235, 10766, 11312, 11872, 12448, 13038, 13643,
+	14263, 14898, 15548, 16214, 16894, 17590, 18302, 19028, 19770, 20528,
+	21301, 22090, 22895, 23715, 24551, 25403, 26271, 27154, 28054, 28970,
+	29901, 30849, 31813, 32793, 33790, 34802, 35831, 36877, 37939, 39017,
+	40112, 41223, 42351, 43496, 44657, 45835, 47029, 48241, 49469, 50714,
+	51976, 53255, 54551, 55864, 57195, 58542, 59906, 61287, 62686, 64102,
+	65535
+};
+static const uint16_t bitSpread[3][16] = {			// Each bit of a nibble repeated 2, 3 or 4 times, for the scaled blits
+	{0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F, 0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF},
+	{0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF, 0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF},
+	{0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF, 0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF}
+};
+static const int16_t sineTable[91] = {			// sin(0 - 90 degrees) * 16384, for arcs
+	0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+	2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+	5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+	8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+#ifdef ST7565R_GRAYSCALE
+static uint8_t grayPlanes[2][SCREENBYTES];		// Low and high bits of each pixel's gray level, laid out like curScreen
+static uint8_t grayPage[SCREENWIDTH];			// A page of curScreen over the subframe's plane, what actually gets sent
+static uint16_t grayStart[SCREENPAGES];			// Columns of each page where the planes may differ, nothing else changes between subframes
+static uint16_t grayEnd[SCREENPAGES];
+static uint8_t graySubframe = 0;
+static ST7565R_GrayStats grayStats;
+#endif
+#ifdef ST7565R_SELF_CHECK
+static uint8_t checkScreen[DRAWWIDTH * ST7565R_num_pages_from_height(DRAWHEIGHT)];	// ST7565R_selfCheck()'s reference, laid out the way the paint functions see the screen
+#endif
+#ifdef ST7565R_ASSET_PACK
+static ST7565R_PackSlot packCache[ST7565R_PACK_CACHE_SLOTS];
+static uint32_t packClock = 0;					// Fetches so far, stamps the blocks they use
+static ST7565R_PackStats packStats = {0};		// See ST7565R_getPackStats()
+#endif
+#ifdef ST7565R_FRAME_HANDOFF
+static uint8_t* frames[3];						// Triple buffer: one being drawn, one being sent, one waiting in between
+static uint8_t frameBack = 0;					// Drawing task's frame, curScreen points at it
+static uint8_t frameFront = 1;					// Display task's frame, the last one sent
+static atomic_uint_fast8_t frameShared = 2;		// The one in between, | ST7565R_FRAME_FRESH when it holds a frame not sent yet
+#endif
+#ifdef ST7565R_STRIP_MODE
+static ST7565R_DrawCallback drawCallback = NULL;
+static void* drawContext = NULL;
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+static uint8_t stripBuffers[2][SCREENWIDTH];	// One is drawn while the other is sent
+#else
+static uint8_t stripBuffers[1][SCREENWIDTH];
+#endif
+#endif
+
+/****************************************************
+*        PRIVATE FUNCTION PROTOTYPES                *
+****************************************************/
+#ifdef ST7565R_GRAYSCALE
+static void ST7565R_markGraySpans			(int x1, int y1, int x2, int y2);
+static const uint8_t* ST7565R_composeGrayPage(int page, unsigned start, unsigned end);
+#endif
+#ifdef ST7565R_TRACE
+static void ST7565R_traceBytes				(bool data, const uint8_t* bytes, unsigned count);
+#endif
+#ifdef ST7565R_ASSET_PACK
+static const uint8_t* ST7565R_packFetch		(const ST7565R_Pack* pack, uint32_t offset, unsigned length);
+static uint32_t ST7565R_packWord			(const uint8_t* bytes);
+static bool ST7565R_packHeader				(ST7565R_Pack* pack, const uint8_t* header);
+static int ST7565R_packStreamByte			(const ST7565R_Pack* pack, uint32_t* next, uint32_t end, const uint8_t** window, unsigned* left);
+static bool ST7565R_addPackFrame			(const ST7565R_Pack* pack, const ST7565R_PackEntry* entry, unsigned frame, int x, int y);
+#endif
+#if !defined(PAINT_IMMEDIATELY) && !defined(ST7565R_STRIP_MODE) && !defined(ST7565R_FRAME_HANDOFF) && !defined(ST7565R_DISPLAY_LIST)
+static bool ST7565R_flushCurScreen			(uint32_t budget);
+#endif
+#ifndef ST7565R_STRIP_MODE
+static unsigned ST7565R_sendPage			(unsigned page, const uint8_t* cur, unsigned start, unsigned end, bool* displayOff, uint32_t* budget);
+#endif
+static uint8_t* ST7565R_targetPage			(int page);
+static void ST7565R_paintStringAt			(const char* string, int x, int y, unsigned scale);
+static void ST7565R_paintStringBoxAt		(const char* string, int x, int y, unsigned width, unsigned height, ST7565R_Align align, bool wrap);
+#ifdef ST7565R_FRAME_HANDOFF
+static void ST7565R_submitFrame				(void);
+#endif
+#ifdef ST7565R_STRIP_MODE
+static void ST7565R_renderStrips			(void);
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+static void ST7565R_paintBytesHereAsync		(const uint8_t* bytes, unsigned count);
+static void ST7565R_waitForBytes			(void);
+#endif
+#endif
+#ifdef ST7565R_DISPLAY_LIST
+static void ST7565R_listAdd					(ST7565R_Command* command, int x, int y, unsigned width, unsigned height);
+static bool ST7565R_listBounds				(ST7565R_Command* command, int x, int y, unsigned width, unsigned height);
+static void ST7565R_listPush				(ST7565R_Command* command);
+static void ST7565R_runDisplayList			(void);
+static void ST7565R_runCommand				(const ST7565R_Command* command);
+static bool ST7565R_isOccluded				(uint8_t index, uint8_t end, int top, int bottom);
+#endif
+static void ST7565R_paintGlyph				(unsigned glyph, int x, int y, unsigned scale);
+static void ST7565R_addGlyphToCurScreen		(unsigned glyph, int x, int y);
+static const uint8_t* ST7565R_glyphData		(unsigned glyph);
+static const void* ST7565R_fontIdentity		(const ST7565R_Font* font);
+static unsigned ST7565R_glyphIndex			(const ST7565R_Font* font, uint32_t codepoint);
+static uint32_t ST7565R_decodeUTF8			(const char** string);
+static unsigned ST7565R_codepointAdvance	(const ST7565R_Font* font, uint32_t codepoint);
+static void ST7565R_addPixelToCurScreen		(ST7565R_DrawState  drawOrErase, unsigned x, unsigned y);
+static void ST7565R_addBitmapToCurScreen	(const uint8_t* bitmap, int x, int y, unsigned width, unsigned height);
+static void ST7565R_addGlyphScaled			(unsigned glyph, int x, int y, unsigned scale);
+static void ST7565R_addBitmapScaled			(const uint8_t* bitmap, int x, int y, unsigned width, unsigned height, unsigned scale);
+static void ST7565R_addPageScaled			(const uint8_t* columns, unsigned count, unsigned rows, int x, int y, unsigned scale);
+static void ST7565R_transpose8				(const uint8_t* in, uint8_t* out);
+static void ST7565R_addAssetToCurScreen		(const ST7565R_Asset* asset, unsigned frame, int x, int y);
+#ifdef PAINT_IMMEDIATELY
+static void ST7565R_paintRegion				(int x, int y, unsigned width, unsigned height);
+#endif
+static void ST7565R_markDirtyRegion			(int x1, int y1, int x2, int y2);
+static void ST7565R_markDirtySpans			(int x1, int y1, int x2, int y2);
+#ifdef ST7565R_TILE_MAP
+static void ST7565R_paintTileRow			(int page, bool dirtyOnly);
+#if !defined(ST7565R_STRIP_MODE) && !defined(ST7565R_DISPLAY_LIST)
+static void ST7565R_paintChangedTiles		(void);
+#endif
+static void ST7565R_invalidateTiles			(void);
+#endif
+#ifdef ST7565R_SPRITES
+static void ST7565R_markSpriteDirty			(const ST7565R_Sprite* sprite);
+static const uint8_t* ST7565R_composePage	(int page, unsigned start, unsigned end);
+#endif
+static void ST7565R_addRectangleToCurScreen	(ST7565R_DrawState drawOrErase, int x1, int y1, int x2, int y2);
+static void ST7565R_paintCircleShape		(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius, ST7565R_CircleShape shape, int startAngle, int endAngle);
+static void ST7565R_addCircleToCurScreen	(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius, ST7565R_CircleShape shape, int startAngle, int endAngle);
+static void ST7565R_addPolygonToCurScreen	(ST7565R_DrawState drawOrErase, const int16_t* points, unsigned count, int x, int y);
+static void ST7565R_polygonBounds			(const int16_t* points, unsigned count, int* x1, int* y1, int* x2, int* y2);
+static void ST7565R_fillSpans				(ST7565R_DrawState drawOrErase, const ST7565R_Shape* shape, int top, int bottom);
+static bool ST7565R_shapeSpan				(const ST7565R_Shape* shape, int row, int* left, int* right);
+static int ST7565R_sine						(int degrees);
+static unsigned ST7565R_squareRoot			(uint32_t value);
+static int ST7565R_roundedDivide			(int32_t numerator, int32_t denominator);
+static unsigned ST7565R_formatNumber		(uint8_t* chars, int32_t value, uint8_t decimals, int8_t width, char pad);
+static void ST7565R_buildDigitStrip			(void);
+static unsigned ST7565R_digitWidth			(const ST7565R_Font* font);
+static void ST7565R_addNumberCharToCurScreen(uint8_t index, int x, int y);
+static void ST7565R_forgetNumbers			(int x1, int y1, int x2, int y2);
+#ifdef ST7565R_PORTRAIT
+static void ST7565R_physicalBox				(int* x1, int* y1, int* x2, int* y2);
+#ifdef ST7565R_ROTATE_270
+static uint8_t ST7565R_reverseBits			(uint8_t bits);
+#endif
+static void ST7565R_blendColumn				(int column, int row, uint8_t bits, uint8_t mask);
+static void ST7565R_addGlyphRotated			(const uint8_t* charData, int x, int y, int startX, int startY, int x2, int y2);
+static void ST7565R_addBitmapRotated		(const uint8_t* bitmap, int x, int y, unsigned width, int startX, int startY, int x2, int y2);
+static void ST7565R_blendBlockRotated		(int x, int y, const uint8_t* bits, const uint8_t* masks);
+#endif
+static void ST7565R_startBacklightFade		(uint8_t brightness, uint32_t ticks);
+static uint32_t ST7565R_msToTicks			(uint32_t ms);
+#ifdef ST7565R_SELF_CHECK
+static uint32_t ST7565R_checkRandom			(uint32_t* state);
+static void ST7565R_checkPixel				(int x, int y, bool on);
+static void ST7565R_checkBitmap				(const uint8_t* bitmap, int x, int y, unsigned width, unsigned height, unsigned scale);
+static void ST7565R_checkString				(const char* string, int x, int y, unsigned scale);
+static bool ST7565R_checkCompare			(void);
+#endif
 
 /****************************************************
 *        ST7565R DISPLAY FUNCTIONS                  *
 ****************************************************/
 void ST7565R_command(uint8_t cmd)
 {	// This function sends a command to the screen. See list of commands in ST7565R.h
+	if (asleep && cmd == ST7565R_CMD_DISPLAY_ON) {return;}	// The updates' DISPLAY_ON would end power save. Their data still lands in display RAM
 	ST7565R_digital_write(NHD_CS, LOW);		// Set Chip Select to Low to begin transmission over SPI
 	ST7565R_digital_write(NHD_A0, LOW);		// Set AO Low to specify a Command Transmission
+#ifdef ST7565R_TRACE
+	ST7565R_traceBytes(false, &cmd, 1);
+#endif
 	ST7565R_spi_transmit(cmd);				// Transmit command via SPI
 	ST7565R_digital_write(NHD_CS, HIGH);	// Set Chip Select to High to signal end of transmission
 }
@@ -79,294 +341,2889 @@ void ST7565R_paintByteHere(uint8_t byte)
 {	// This function simply draws the byte as is in the preselected location
 	ST7565R_digital_write(NHD_CS, LOW);		// Set Chip Select to Low to signal beginning of transmission over SPI
 	ST7565R_digital_write(NHD_A0, HIGH);	// Set AO High to specify a data transmission
+#ifdef ST7565R_TRACE
+	ST7565R_traceBytes(true, &byte, 1);
+#endif
 	ST7565R_spi_transmit(byte); 			// Transmit data byte through SPI
 	ST7565R_digital_write(NHD_CS, HIGH);	// Set Chip Select to High to signal end of transmission
 }
 
+void ST7565R_paintBytesHere(const uint8_t* bytes, unsigned count)
+{	// Draw a run of bytes starting at the preselected location, the column moves right after each byte
+	if (count == 0) {return;}
+	ST7565R_digital_write(NHD_CS, LOW);				// Set Chip Select to Low to signal beginning of transmission over SPI
+	ST7565R_digital_write(NHD_A0, HIGH);			// Set AO High to specify a data transmission
+#ifdef ST7565R_TRACE
+	ST7565R_traceBytes(true, bytes, count);
+#endif
+	ST7565R_spi_transmit_buffer(bytes, count);		// Transmit the whole run in one transmission
+	ST7565R_digital_write(NHD_CS, HIGH);			// Set Chip Select to High to signal end of transmission
+}
+
 void ST7565R_paintByte(uint8_t byte, unsigned column, unsigned page)
 {	// Paint a byte of data at a specified column and page (Columns are along x-axis, Pages are along y-axis in groups of 8)
+	// These are the panel's own columns and pages, portrait doesn't turn them
 	if (column >= SCREENWIDTH)	{return;}
 	if (page >= SCREENPAGES)	{return;}
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {
+		.type = COMMAND_BYTE, .x = column, .y = page * 8,
+		.left = column, .top = page * 8, .right = column + 1, .bottom = (page * 8) + 8, .data.number = byte
+	};
+	ST7565R_listPush(&command);
+	return;
+#endif
+#ifdef ST7565R_STRIP_MODE
+	if ((int)page == targetFirstPage && drawableTop < drawableBottom) {target[column] = byte;}	// Only while drawing that page
+	return;
+#endif
 	int byteIndex = (SCREENWIDTH * page) + column;
 	curScreen[byteIndex] = byte;
+	ST7565R_markDirtyRegion(column, page * 8, column + 1, page * 8 + 1);
+#ifdef PAINT_IMMEDIATELY
 	uint8_t colMSB = column / 0x10;
 	uint8_t colLSB = column % 0x10;
 
+	ST7565R_lock();
 	ST7565R_command(ST7565R_CMD_DISPLAY_OFF);		        // Set Display OFF
 	ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(page));    // Specify which page to draw to
 	ST7565R_command(ST7565R_CMD_COLUMN_MSB(colMSB));	    // Specify which column to draw to, upper 4 bits + 0x10
 	ST7565R_command(ST7565R_CMD_COLUMN_LSB(colLSB));	    // Specify which column to draw to, lower 4 bits + 0x00
 	ST7565R_paintByteHere(byte);							// Paint the byte passed to the function
 	ST7565R_command(ST7565R_CMD_DISPLAY_ON);				// Set Display ON
+	ST7565R_unlock();
+#endif
+}
+
+void ST7565R_paintPixel(ST7565R_DrawState drawOrErase, unsigned x, unsigned y)
+{	// Paint an individual pixel at a specified (x,y) coordinate.  DON'T FORGET TO updateDisplay()
+	int screenX = (int)x + viewport.originX;
+	int screenY = (int)y + viewport.originY;
+	if (screenX < viewport.left || screenX >= viewport.right) 	{return;}
+	if (screenY < viewport.top  || screenY >= viewport.bottom)	{return;}
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_PIXEL, .param = {drawOrErase}};
+	ST7565R_listAdd(&command, screenX, screenY, 1, 1);
+	return;
+#endif
+	ST7565R_addPixelToCurScreen(drawOrErase, screenX, screenY);
+	ST7565R_markDirtyRegion(screenX, screenY, screenX + 1, screenY + 1);
+#ifdef PAINT_IMMEDIATELY
+#ifdef ST7565R_PORTRAIT
+	int x2 = screenX + 1, y2 = screenY + 1;
+	ST7565R_physicalBox(&screenX, &screenY, &x2, &y2);
+#endif
+	int byteIndex = (SCREENWIDTH * (screenY / 8)) + screenX;
+	uint8_t colMSB = screenX / 0x10;
+	uint8_t colLSB = screenX % 0x10;
+	ST7565R_lock();
+	ST7565R_command(ST7565R_CMD_DISPLAY_OFF);		    		// Set Display OFF
+	ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(screenY/8)); 	// Specify which page to draw to
+	ST7565R_command(ST7565R_CMD_COLUMN_MSB(colMSB));			// Specify which column to draw to, upper 4 bits + 0x10
+	ST7565R_command(ST7565R_CMD_COLUMN_LSB(colLSB));			// Specify which column to draw to, lower 4 bits + 0x00
+	ST7565R_paintByteHere(curScreen[byteIndex]);				// Paint the new byte with the new pixel
+	ST7565R_command(ST7565R_CMD_DISPLAY_ON);					// Set Display ON
+	ST7565R_unlock();
+#endif
+}
+
+void ST7565R_paintString(char* string, unsigned x, unsigned y)
+{	// Paint a UTF-8 string of characters at a specified (x,y) coordinate. DON'T FORGET TO updateDisplay()
+	ST7565R_paintStringScaled(string, x, y, 1);
+}
+
+void ST7565R_paintStringScaled(char* string, unsigned x, unsigned y, unsigned scale)
+{	// paintString() with every pixel of the font scale x scale (1 - ST7565R_SCALE_MAX), for big readouts without a big font
+	if (string == NULL)	 	{return;}
+	int screenX = (int)x + viewport.originX;
+	int screenY = (int)y + viewport.originY;
+	scale = (scale == 0) ? 1 : (scale > ST7565R_SCALE_MAX) ? ST7565R_SCALE_MAX : scale;
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_STRING, .param = {0, scale}, .data.string = string};
+	ST7565R_listAdd(&command, screenX, screenY, viewport.right - screenX, viewport.bottom - screenY);
+	return;
+#endif
+	ST7565R_paintStringAt(string, screenX, screenY, scale);
+}
+
+void ST7565R_paintChar(char c, unsigned x, unsigned y)
+{	// Paint an individual character at a specified (x,y) coordinate
+	ST7565R_paintCharScaled(c, x, y, 1);
+}
+
+void ST7565R_paintCharScaled(char c, unsigned x, unsigned y, unsigned scale)
+{	// paintChar() scale times the size (1 - ST7565R_SCALE_MAX)
+	scale = (scale == 0) ? 1 : (scale > ST7565R_SCALE_MAX) ? ST7565R_SCALE_MAX : scale;
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_GLYPH, .param = {0, scale}, .data.number = ST7565R_glyphIndex(&curFont, (uint8_t)c)};
+	ST7565R_listAdd(&command, (int)x + viewport.originX, (int)y + viewport.originY, curFont.width * scale, curFont.height * scale);
+	return;
+#endif
+	ST7565R_paintGlyph(ST7565R_glyphIndex(&curFont, (uint8_t)c), (int)x + viewport.originX, (int)y + viewport.originY, scale);
+}
+
+void ST7565R_measureString(char* string, unsigned* width, unsigned* height)
+{	// Find the size paintString would cover, without painting anything
+	unsigned lineWidth 	= 0;
+	unsigned maxWidth 	= 0;
+	unsigned lines 		= 1;
+	const char* next 	= string;
+
+	while (next != NULL && *next != '\0')
+	{
+		uint32_t codepoint = ST7565R_decodeUTF8(&next);
+		switch (codepoint)
+		{
+		case '\n': // New Line
+			lines++;
+			continue;
+		case '\r': // Carriage Return
+			lineWidth = 0;
+			continue;
+		}
+		lineWidth += ST7565R_codepointAdvance(&curFont, codepoint);
+		if (lineWidth > maxWidth) {maxWidth = lineWidth;}
+	}
+
+	if (width != NULL)	{*width = maxWidth;}
+	if (height != NULL)	{*height = (string == NULL) ? 0 : (lines * (curFont.height + 1)) - 1;}
+}
+
+void ST7565R_paintStringBox(char* string, int x, int y, unsigned width, unsigned height, ST7565R_Align align, bool wrap)
+{	// Lay out a UTF-8 string inside a box: wrap words at the box edge (optional), align each line, and clip
+	// to the box. Each line is measured once and then painted, glyphs outside the box are skipped entirely.
+	if (string == NULL || width == 0 || height == 0) {return;}
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_STRING_BOX, .param = {align, wrap}, .data.string = string};
+	ST7565R_listAdd(&command, x + viewport.originX, y + viewport.originY, width, height);
+	return;
+#endif
+	ST7565R_paintStringBoxAt(string, x + viewport.originX, y + viewport.originY, width, height, align, wrap);
+}
+
+void ST7565R_paintFullscreenBitmap(uint8_t* bitmap)
+{// Paint a bitmap that matches the size of the screen,  DON"T FORGET TO updateDisplay()
+	if (bitmap == NULL)
+	{	// Catch Null Pointers
+		ST7565R_paintRectangle(ERASE, 0, 0, DRAWWIDTH, DRAWHEIGHT);
+		return;
+	}
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_BITMAP, .data.bitmap = bitmap};
+	ST7565R_listAdd(&command, viewport.originX, viewport.originY, DRAWWIDTH, DRAWHEIGHT);
+	return;
+#endif
+
+	ST7565R_addBitmapToCurScreen(bitmap, viewport.originX, viewport.originY, DRAWWIDTH, DRAWHEIGHT);
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(viewport.originX, viewport.originY, DRAWWIDTH, DRAWHEIGHT);
+#endif
+}
+
+void ST7565R_paintBitmap(uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height)
+{	// Paint a bitmap to a specified (x,y) coordinate of the screen
+	ST7565R_paintBitmapScaled(bitmap, x, y, width, height, 1);
+}
+
+void ST7565R_paintBitmapScaled(uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height, unsigned scale)
+{	// paintBitmap() scale times the size (1 - ST7565R_SCALE_MAX), covering width * scale by height * scale
+	if (bitmap == NULL)	   	{return;}
+	int screenX = (int)x + viewport.originX;
+	int screenY = (int)y + viewport.originY;
+	scale = (scale == 0) ? 1 : (scale > ST7565R_SCALE_MAX) ? ST7565R_SCALE_MAX : scale;
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_BITMAP, .param = {0, scale}, .data.bitmap = bitmap};
+	ST7565R_listAdd(&command, screenX, screenY, width * scale, height * scale);
+	return;
+#endif
+
+	ST7565R_addBitmapScaled(bitmap, screenX, screenY, width, height, scale);
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(screenX, screenY, width * scale, height * scale);
+#endif
+}
+
+void ST7565R_paintAsset(const ST7565R_Asset* asset, unsigned frame, int x, int y)
+{	// Paint one frame of an asset made by tools/bmpconv.c (see bitmaps.h) with its top left corner at (x,y)
+	if (asset == NULL || frame >= asset->frames) {return;}
+	int screenX = x + viewport.originX;
+	int screenY = y + viewport.originY;
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_ASSET, .param = {frame & 0xFF, frame >> 8}, .data.asset = asset};
+	ST7565R_listAdd(&command, screenX, screenY, asset->width, asset->height);
+	return;
+#endif
+
+	ST7565R_addAssetToCurScreen(asset, frame, screenX, screenY);
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(screenX, screenY, asset->width, asset->height);
+#endif
+}
+
+const uint8_t* ST7565R_assetBitmap(const ST7565R_Asset* asset, unsigned frame)
+{	// A raw asset frame as a plain bitmap, for paintBitmap() or icon widgets. NULL for packed assets
+	if (asset == NULL || frame >= asset->frames || asset->encoding != ASSET_RAW) {return NULL;}
+	return &asset->data[asset->frameOffsets[frame]];
+}
+
+#ifdef ST7565R_ASSET_PACK
+static bool ST7565R_packHeader(ST7565R_Pack* pack, const uint8_t* header){
+	// Take the index's place and size from a pack's header. False if it isn't a pack of this version
+	if (memcmp(header, "S7AP", 4) != 0 || header[4] != ST7565R_PACK_VERSION) {return false;}
+	pack->count = header[6] | (header[7] << 8);
+	pack->index = ST7565R_packWord(&header[8]);
+	pack->size 	= ST7565R_packWord(&header[12]);
+	return pack->index <= pack->size && (uint32_t)pack->count * ST7565R_PACK_ENTRY_BYTES <= pack->size - pack->index;
+}
+
+bool ST7565R_packOpen(ST7565R_Pack* pack, ST7565R_PackRead read, void* context)
+{	// Open a pack read through read(), from SPI flash or a file. False if there isn't a pack of this version there
+	if (pack == NULL || read == NULL) {return false;}
+	uint8_t header[ST7565R_PACK_HEADER_BYTES];
+	ST7565R_packClose(pack);
+	*pack = (ST7565R_Pack){.read = read, .context = context};
+	if (!read(0, header, sizeof header, context) || !ST7565R_packHeader(pack, header))
+	{
+		pack->count = 0;
+		return false;
+	}
+	packStats.bytesRead += sizeof header;
+	return true;
+}
+
+bool ST7565R_packOpenMapped(ST7565R_Pack* pack, const uint8_t* data, uint32_t size)
+{	// Open a pack that's in memory: memory mapped flash, a mmap()ed file. Its frame offsets and glyph tables are used in place,
+	// so it has to start 4 byte aligned, and like the converters' output it's little endian
+	if (pack == NULL || data == NULL || size < ST7565R_PACK_HEADER_BYTES || ((uintptr_t)data % 4) != 0) {return false;}
+	ST7565R_packClose(pack);
+	*pack = (ST7565R_Pack){.mapped = data};
+	if (!ST7565R_packHeader(pack, data) || pack->size > size)
+	{
+		pack->count = 0;
+		return false;
+	}
+	return true;
+}
+
+void ST7565R_packClose(const ST7565R_Pack* pack)
+{	// Forget the pack's cached blocks, before the struct is reused or the pack behind it is rewritten
+	for (int i = 0; i < ST7565R_PACK_CACHE_SLOTS; i++)
+	{
+		if (packCache[i].pack == pack) {packCache[i].pack = NULL;	packCache[i].used = 0;}
+	}
+}
+
+bool ST7565R_packEntry(const ST7565R_Pack* pack, unsigned index, ST7565R_PackEntry* entry)
+{	// Read entry index of the pack's index. False if there's no such entry or it points past the end of the pack
+	if (pack == NULL || entry == NULL || index >= pack->count) {return false;}
+	const uint8_t* bytes = ST7565R_packFetch(pack, pack->index + (index * ST7565R_PACK_ENTRY_BYTES), ST7565R_PACK_ENTRY_BYTES);
+	if (bytes == NULL) {return false;}
+	entry->kind 		= bytes[0];
+	entry->encoding 	= bytes[1];
+	entry->width 		= bytes[2] | (bytes[3] << 8);
+	entry->height 		= bytes[4] | (bytes[5] << 8);
+	entry->count 		= bytes[6] | (bytes[7] << 8);
+	entry->firstChar 	= bytes[8];
+	entry->lastChar 	= bytes[9];
+	entry->ascent 		= bytes[10];
+	entry->descent 		= bytes[11];
+	entry->table 		= ST7565R_packWord(&bytes[12]);
+	entry->data 		= ST7565R_packWord(&bytes[16]);
+	entry->length 		= ST7565R_packWord(&bytes[20]);
+	entry->tiles 		= ST7565R_packWord(&bytes[24]);
+	return entry->data <= pack->size && entry->length <= pack->size - entry->data && entry->table <= pack->size;
+}
+
+bool ST7565R_packAsset(const ST7565R_Pack* pack, unsigned index, ST7565R_Asset* asset)
+{	// Fill in asset from a mapped pack's asset, pointing into the pack. Paint it with paintAsset(), also with ST7565R_DISPLAY_LIST
+	ST7565R_PackEntry entry;
+	if (pack == NULL || pack->mapped == NULL || asset == NULL || !ST7565R_packEntry(pack, index, &entry) || entry.kind != PACK_ASSET) {return false;}
+	*asset = (ST7565R_Asset){
+		.width 			= entry.width,
+		.height 		= entry.height,
+		.frames 		= entry.count,
+		.encoding 		= entry.encoding,
+		.frameOffsets 	= (const uint32_t*)&pack->mapped[entry.table],
+		.data 			= &pack->mapped[entry.data],
+		.tiles 			= (entry.encoding == ASSET_TILED) ? &pack->mapped[entry.tiles] : NULL
+	};
+	return true;
+}
+
+bool ST7565R_paintPackAsset(const ST7565R_Pack* pack, unsigned index, unsigned frame, int x, int y)
+{	// Paint one frame of a pack's asset with its top left corner at (x,y), like paintAsset(). Streamed packs are fetched as it's painted,
+	// columns outside the clip aren't read. False if it isn't an asset with that frame or a read failed. Not with ST7565R_DISPLAY_LIST,
+	// which paints later: keep an asset from ST7565R_packAsset() and paintAsset() that
+	ST7565R_PackEntry entry;
+	if (!ST7565R_packEntry(pack, index, &entry) || entry.kind != PACK_ASSET || frame >= entry.count) {return false;}
+#ifdef ST7565R_DISPLAY_LIST
+	return false;
+#endif
+	int screenX = x + viewport.originX;
+	int screenY = y + viewport.originY;
+	bool painted = true;
+	if (pack->mapped != NULL)
+	{
+		ST7565R_Asset asset;
+		painted = ST7565R_packAsset(pack, index, &asset);
+		if (painted) {ST7565R_addAssetToCurScreen(&asset, frame, screenX, screenY);}
+	}
+	else
+	{
+		painted = ST7565R_addPackFrame(pack, &entry, frame, screenX, screenY);
+	}
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(screenX, screenY, entry.width, entry.height);
+#endif
+	return painted;
+}
+
+bool ST7565R_packFont(const ST7565R_Pack* pack, unsigned index, ST7565R_PackFont* stream, ST7565R_Glyph* table, unsigned tableSize, ST7565R_Font* font)
+{	// Fill in font from a pack's font, ready for configureFont(), which it doesn't call. A mapped pack's glyphs are used in place.
+	// Otherwise they're fetched as they're painted through stream, which has to outlive the font, and a proportional font's glyph
+	// table is copied into table, which needs an entry per glyph (see ST7565R_packEntry()). Set ranges and fallbackGlyph yourself
+	// before configuring it if the font has symbols
+	ST7565R_PackEntry entry;
+	if (font == NULL || !ST7565R_packEntry(pack, index, &entry) || entry.kind == PACK_ASSET) {return false;}
+	bool proportional = entry.kind == PACK_FONT_PROPORTIONAL;
+	*font = (ST7565R_Font){
+		.width 		= (uint8_t)entry.width,
+		.height 	= (uint8_t)entry.height,
+		.firstChar 	= (char)entry.firstChar,
+		.lastChar 	= (char)entry.lastChar,
+		.ascent 	= entry.ascent,
+		.descent 	= entry.descent
+	};
+	if (pack->mapped != NULL)
+	{
+		font->glyphs 		= &pack->mapped[entry.data];
+		font->glyphTable 	= proportional ? (const ST7565R_Glyph*)&pack->mapped[entry.table] : NULL;
+		return true;
+	}
+
+	if (stream == NULL || (proportional && (table == NULL || tableSize < entry.count))) {return false;}
+	for (unsigned glyph = 0; proportional && glyph < entry.count; glyph++)
+	{	// 4 bytes a glyph: offset, width, advance
+		const uint8_t* bytes = ST7565R_packFetch(pack, entry.table + (glyph * 4), 4);
+		if (bytes == NULL) {return false;}
+		table[glyph] = (ST7565R_Glyph){.offset = bytes[0] | (bytes[1] << 8), .width = bytes[2], .advance = bytes[3]};
+	}
+	stream->pack 		= pack;
+	stream->data 		= entry.data;
+	font->stream 		= stream;
+	font->glyphTable 	= proportional ? table : NULL;
+	return true;
+}
+
+ST7565R_PackStats ST7565R_getPackStats(void)
+{	// How well the cache is doing, see ST7565R_PACK_CACHE_SLOTS
+	return packStats;
+}
+#endif
+
+void ST7565R_paintRectangle(ST7565R_DrawState drawOrErase, unsigned x, unsigned y, unsigned width, unsigned height){
+	int x1 = (int)x + viewport.originX;
+	int y1 = (int)y + viewport.originY;
+	int x2 = x1 + (int)width;
+	int y2 = y1 + (int)height;
+	if (x1 < viewport.left) 	{x1 = viewport.left;}
+	if (y1 < viewport.top) 		{y1 = viewport.top;}
+	if (x2 > viewport.right) 	{x2 = viewport.right;}
+	if (y2 > viewport.bottom) 	{y2 = viewport.bottom;}
+	if (x1 >= x2 || y1 >= y2) 	{return;}
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_RECTANGLE, .param = {drawOrErase}};
+	ST7565R_listAdd(&command, x1, y1, x2 - x1, y2 - y1);
+	return;
+#endif
+
+	ST7565R_addRectangleToCurScreen(drawOrErase, x1, y1, x2, y2);
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(x1, y1, x2 - x1, y2 - y1);
+#endif
+}
+
+void ST7565R_paintCircle(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius)
+{	// One pixel outline centred on (x,y)
+	ST7565R_paintCircleShape(drawOrErase, x, y, radius, CIRCLE_OUTLINE, 0, 360);
+}
+
+void ST7565R_paintFilledCircle(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius)
+{	// Same footprint as paintCircle(), filled
+	ST7565R_paintCircleShape(drawOrErase, x, y, radius, CIRCLE_FILLED, 0, 360);
+}
+
+void ST7565R_paintArc(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius, int startAngle, int endAngle)
+{	// Part of paintCircle()'s outline, clockwise from startAngle to endAngle in degrees. 0 is 3 o'clock and 90 is 6 o'clock,
+	// an end before the start wraps round through 0, and 360 degrees or more is the whole circle
+	int sweep = endAngle - startAngle;
+	if (sweep >= 360)
+	{
+		ST7565R_paintCircleShape(drawOrErase, x, y, radius, CIRCLE_OUTLINE, 0, 360);
+		return;
+	}
+	sweep 		= ((sweep % 360) + 360) % 360;
+	startAngle 	= ((startAngle % 360) + 360) % 360;
+	ST7565R_paintCircleShape(drawOrErase, x, y, radius, CIRCLE_ARC, startAngle, startAngle + sweep);
+}
+
+void ST7565R_paintTriangle(ST7565R_DrawState drawOrErase, int x0, int y0, int x1, int y1, int x2, int y2)
+{	// Filled triangle, corners included
+	int16_t points[6] = {x0, y0, x1, y1, x2, y2};
+#ifdef ST7565R_DISPLAY_LIST
+	int left, top, right, bottom;
+	ST7565R_polygonBounds(points, 3, &left, &top, &right, &bottom);
+	ST7565R_Command command = {
+		.type = COMMAND_TRIANGLE, .param = {drawOrErase}, .x = x0 + viewport.originX, .y = y0 + viewport.originY,
+		.width = x1 + viewport.originX, .height = y1 + viewport.originY,
+		.data.point = {x2 + viewport.originX, y2 + viewport.originY}
+	};
+	if (ST7565R_listBounds(&command, left + viewport.originX, top + viewport.originY, right - left, bottom - top))
+	{
+		ST7565R_listPush(&command);
+	}
+	return;
+#endif
+	ST7565R_paintPolygon(drawOrErase, points, 3);
+}
+
+void ST7565R_paintPolygon(ST7565R_DrawState drawOrErase, const int16_t* points, unsigned count)
+{	// Filled convex polygon through count corners, points holds x,y pairs. With ST7565R_DISPLAY_LIST the points are only
+	// read when the list is drawn, so keep them unchanged until updateDisplay()
+	if (points == NULL || count == 0) {return;}
+	int x1, y1, x2, y2;
+	ST7565R_polygonBounds(points, count, &x1, &y1, &x2, &y2);
+	x1 += viewport.originX;
+	y1 += viewport.originY;
+	x2 += viewport.originX;
+	y2 += viewport.originY;
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {
+		.type = COMMAND_POLYGON, .param = {drawOrErase}, .x = viewport.originX, .y = viewport.originY, .width = count, .data.points = points
+	};
+	if (ST7565R_listBounds(&command, x1, y1, x2 - x1, y2 - y1)) {ST7565R_listPush(&command);}
+	return;
+#endif
+
+	ST7565R_addPolygonToCurScreen(drawOrErase, points, count, viewport.originX, viewport.originY);
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(x1, y1, x2 - x1, y2 - y1);
+#endif
+}
+
+void ST7565R_clearScreen(void)
+{	// Erase the entire screen
+	ST7565R_lock();
+#ifdef ST7565R_TILE_MAP
+	ST7565R_clearTiles();
+#endif
+#if defined(ST7565R_DISPLAY_LIST)
+	ST7565R_critical_enter();
+	listTail = listHead;						// Every update starts blank, dropping what's queued is all it takes
+	listNumFonts = 0;
+	ST7565R_critical_exit();
+#elif !defined(ST7565R_STRIP_MODE)
+	memset(curScreen, 0x00, SCREENBYTES);
+	ST7565R_markDirtyRegion(0, 0, DRAWWIDTH, DRAWHEIGHT);
+#ifdef ST7565R_GRAYSCALE
+	memset(grayPlanes, 0x00, sizeof(grayPlanes));
+	memset(grayStart, 0x00, sizeof(grayStart));
+	memset(grayEnd, 0x00, sizeof(grayEnd));
+#endif
+#ifdef PAINT_IMMEDIATELY
+	bool displayOff = false;
+	for (int page = 0; page < SCREENPAGES; page++)
+	{
+		ST7565R_sendPage(page, &curScreen[SCREENWIDTH * page], 0, SCREENWIDTH, &displayOff, NULL);
+	}
+	if (displayOff)
+	{
+		ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+	}
+#endif
+#endif
+	ST7565R_updateDisplay();
+	ST7565R_unlock();
+}
+
+void ST7565R_updateDisplay(void){
+	ST7565R_lock();
+#if defined(ST7565R_TILE_MAP) && !defined(ST7565R_STRIP_MODE) && !defined(ST7565R_DISPLAY_LIST)
+	ST7565R_paintChangedTiles();		// Strips and the display list copy every cell into each page instead
+#endif
+#if defined(ST7565R_STRIP_MODE)
+	ST7565R_renderStrips();
+#elif defined(ST7565R_FRAME_HANDOFF)
+	ST7565R_submitFrame();
+#elif defined(ST7565R_DISPLAY_LIST)
+	ST7565R_runDisplayList();
+#elif !defined(PAINT_IMMEDIATELY)
+	ST7565R_flushCurScreen(UINT32_MAX);
+#endif
+	ST7565R_unlock();
+}
+
+bool ST7565R_updateDisplayBudget(uint32_t maxMicroseconds)
+{	// updateDisplay() that stops once maxMicroseconds of SPI traffic is used up, for a frame loop with a hard deadline.
+	// The most recently painted pages go first, and whatever doesn't fit stays dirty for the next call. Returns whether
+	// the whole screen is up to date. Only the default buffered mode can stop part way, the others do a full update
+#if defined(PAINT_IMMEDIATELY) || defined(ST7565R_STRIP_MODE) || defined(ST7565R_FRAME_HANDOFF) || defined(ST7565R_DISPLAY_LIST)
+	(void)maxMicroseconds;
+	ST7565R_updateDisplay();
+	return true;
+#else
+	uint64_t bytes = ((uint64_t)maxMicroseconds * ST7565R_SPI_CLOCK_HZ) / 8000000;	// 8 clocks a byte
+	if (bytes >= UINT32_MAX) {bytes = UINT32_MAX - 1;}								// UINT32_MAX means no budget
+	ST7565R_lock();
+#ifdef ST7565R_TILE_MAP
+	ST7565R_paintChangedTiles();
+#endif
+	bool complete = ST7565R_flushCurScreen((uint32_t)bytes);
+	ST7565R_unlock();
+	return complete;
+#endif
+}
+
+ST7565R_FlushStats ST7565R_getFlushStats(void)
+{	// What the last updates cost on the wire, to check a frame budget against. Default buffered mode only (the scrub counts in every mode)
+	return flushStats;
+}
+
+void ST7565R_scrubTick(void)
+{	// ST7565R_SCRUB: call from a timer or the main loop. Rewrites the next ST7565R_SCRUB_COLUMNS bytes of display RAM, a page at a time
+	// from left to right, with what the driver knows is there: lastScreen, or curScreen when painting immediately. Those are only ever
+	// updated as bytes go out, so a correct byte is rewritten as itself and nothing flickers. With ST7565R_FRAME_HANDOFF call it from
+	// the display task, it doesn't take the drawing lock there because lastScreen belongs to flushFrame(). Otherwise a tick that
+	// finds the driver locked, e.g. because it interrupted an update part way through a page, leaves the wire alone until the next
+#ifdef ST7565R_SCRUB
+#ifndef ST7565R_FRAME_HANDOFF
+	if (lockDepth != 0) {return;}
+	ST7565R_lock();
+#endif
+#ifdef PAINT_IMMEDIATELY
+	const uint8_t* known = &curScreen[SCREENWIDTH * scrubPage];
+#else
+	const uint8_t* known = &lastScreen[SCREENWIDTH * scrubPage];
+#endif
+	unsigned count = SCREENWIDTH - scrubColumn;
+	if (count > ST7565R_SCRUB_COLUMNS) {count = ST7565R_SCRUB_COLUMNS;}
+	ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(scrubPage));
+	ST7565R_command(ST7565R_CMD_COLUMN_MSB(scrubColumn / 0x10));
+	ST7565R_command(ST7565R_CMD_COLUMN_LSB(scrubColumn % 0x10));
+	ST7565R_paintBytesHere(&known[scrubColumn], count);
+	flushStats.scrubBytes += 3 + count;
+
+	scrubColumn += count;
+	if (scrubColumn >= SCREENWIDTH)
+	{	// Next page, and after the last one start over
+		scrubColumn = 0;
+		if (++scrubPage >= SCREENPAGES)
+		{
+			scrubPage = 0;
+			flushStats.scrubPasses++;
+		}
+	}
+#ifndef ST7565R_FRAME_HANDOFF
+	ST7565R_unlock();
+#endif
+#endif
+}
+
+bool ST7565R_flushFrame(void)
+{	// ST7565R_FRAME_HANDOFF: call from the display task. Sends the newest frame published by updateDisplay() if it hasn't
+	// been sent yet, and returns whether it sent one. Doesn't take the drawing lock, so drawing carries on meanwhile
+#ifdef ST7565R_FRAME_HANDOFF
+	if ((atomic_load(&frameShared) & ST7565R_FRAME_FRESH) == 0) {return false;}
+	frameFront = atomic_exchange(&frameShared, frameFront) & ~ST7565R_FRAME_FRESH;
+
+	const uint8_t* frame = frames[frameFront];
+	bool displayOff = false;
+	for (int page = 0; page < SCREENPAGES; page++)
+	{	// Frames come from anywhere, so compare all of each page against what's on the display
+		ST7565R_sendPage(page, &frame[SCREENWIDTH * page], 0, SCREENWIDTH, &displayOff, NULL);
+	}
+	if (displayOff)
+	{
+		ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+	}
+	memcpy(lastScreen, frame, SCREENBYTES);
+	return true;
+#else
+	return false;
+#endif
+}
+
+uint16_t ST7565R_displayListDropped(void)
+{	// ST7565R_DISPLAY_LIST: how many commands were dropped because the list was full. Raise ST7565R_DISPLAY_LIST_SIZE if this isn't 0
+#ifdef ST7565R_DISPLAY_LIST
+	return listDropped;
+#else
+	return 0;
+#endif
+}
+
+void ST7565R_setDrawCallback(ST7565R_DrawCallback draw, void* context)
+{	// ST7565R_STRIP_MODE: the function that paints the screen, called once per page by updateDisplay(). context is passed along
+#ifdef ST7565R_STRIP_MODE
+	drawCallback = draw;
+	drawContext = context;
+#else
+	(void)draw;
+	(void)context;
+#endif
+}
+
+void ST7565R_markDirty(int x, int y, unsigned width, unsigned height)
+{	// Make the next updateDisplay() compare (and send if changed) a box, in the current viewport's coordinates
+	int x1 = x + viewport.originX;
+	int y1 = y + viewport.originY;
+	int x2 = x1 + (int)width;
+	int y2 = y1 + (int)height;
+	if (x1 < 0) 			{x1 = 0;}
+	if (y1 < 0) 			{y1 = 0;}
+	if (x2 > DRAWWIDTH) 	{x2 = DRAWWIDTH;}
+	if (y2 > DRAWHEIGHT) 	{y2 = DRAWHEIGHT;}
+	if (x1 >= x2 || y1 >= y2) {return;}
+	ST7565R_markDirtyRegion(x1, y1, x2, y2);
+}
+
+
+
+#ifdef ST7565R_SPRITES
+/****************************************************
+*        SPRITE FUNCTIONS		                    *
+****************************************************/
+bool ST7565R_addSprite(ST7565R_Sprite* sprite, const uint8_t* bitmap, const uint8_t* mask, int x, int y, unsigned width, unsigned height)
+{	// Put a sprite on top of the others, in screen coordinates. bitmap and mask are vertically oriented like paintBitmap().
+	// Sprites are at most 255 pixels each way, anything bigger is refused and returns false
+	if (width > UINT8_MAX || height > UINT8_MAX) {return false;}
+	ST7565R_lock();
+	ST7565R_removeSprite(sprite);				// Adding it twice just brings it to the top
+	sprite->bitmap 	= bitmap;
+	sprite->mask 	= mask;
+	sprite->x 		= x;
+	sprite->y 		= y;
+	sprite->width 	= width;
+	sprite->height 	= height;
+	sprite->mode 	= SPRITE_MASKED;
+	sprite->visible = true;
+	sprite->next 	= NULL;
+
+	ST7565R_Sprite** link = &spriteList;
+	while (*link != NULL) {link = &(*link)->next;}
+	*link = sprite;
+	ST7565R_markSpriteDirty(sprite);
+	ST7565R_unlock();
+	return true;
+}
+
+void ST7565R_removeSprite(ST7565R_Sprite* sprite)
+{	// Take a sprite off the screen for good, the background shows through again on the next update
+	ST7565R_lock();
+	for (ST7565R_Sprite** link = &spriteList; *link != NULL; link = &(*link)->next)
+	{
+		if (*link == sprite)
+		{
+			*link = sprite->next;
+			ST7565R_markSpriteDirty(sprite);
+			break;
+		}
+	}
+	ST7565R_unlock();
+}
+
+void ST7565R_moveSprite(ST7565R_Sprite* sprite, int x, int y)
+{	// Only the box it leaves and the box it lands on get compared on the next update
+	ST7565R_lock();
+	if (sprite->x != x || sprite->y != y)
+	{
+		ST7565R_markSpriteDirty(sprite);
+		sprite->x = x;
+		sprite->y = y;
+		ST7565R_markSpriteDirty(sprite);
+	}
+	ST7565R_unlock();
+}
+
+void ST7565R_setSpriteBitmap(ST7565R_Sprite* sprite, const uint8_t* bitmap, const uint8_t* mask)
+{	// Swap the picture, e.g. the next animation frame. Same size as before
+	ST7565R_lock();
+	sprite->bitmap 	= bitmap;
+	sprite->mask 	= mask;
+	ST7565R_markSpriteDirty(sprite);
+	ST7565R_unlock();
+}
+
+void ST7565R_setSpriteMode(ST7565R_Sprite* sprite, ST7565R_SpriteMode mode)
+{	// SPRITE_MASKED or SPRITE_XOR
+	ST7565R_lock();
+	sprite->mode = mode;
+	ST7565R_markSpriteDirty(sprite);
+	ST7565R_unlock();
+}
+
+void ST7565R_showSprite(ST7565R_Sprite* sprite, bool visible)
+{	// Hide a sprite without losing its place in the stack, e.g. to blink a cursor
+	ST7565R_lock();
+	if (sprite->visible != visible)
+	{
+		sprite->visible = true;					// So its box gets marked either way
+		ST7565R_markSpriteDirty(sprite);
+		sprite->visible = visible;
+	}
+	ST7565R_unlock();
+}
+#endif
+
+
+#ifdef ST7565R_TILE_MAP
+/****************************************************
+*        TILE MAP FUNCTIONS		                    *
+****************************************************/
+void ST7565R_setTileset(const uint8_t* tiles, uint8_t count)
+{	// count tiles of 8 bytes each. Every cell showing a tile gets copied in again on the next update
+	ST7565R_lock();
+	tileset = tiles;
+	tilesetCount = count;
+	ST7565R_invalidateTiles();
+	ST7565R_unlock();
+}
+
+void ST7565R_setTile(unsigned column, unsigned row, uint8_t tile)
+{	// Show a tile in one cell (ST7565R_TILE_NONE gives the cell back to the other paint functions, as it is)
+	if (column >= ST7565R_TILE_COLUMNS || row >= SCREENPAGES) {return;}
+	ST7565R_lock();
+	if (tileMap[row][column] != tile)
+	{
+		tileMap[row][column] = tile;
+		tileDirty[row][column / 8] |= (uint8_t)(0b00000001 << (column % 8));
+#ifdef PAINT_IMMEDIATELY
+		ST7565R_paintTileRow(row, true);
+		unsigned x2 = (column * 8 + 8 < SCREENWIDTH) ? column * 8 + 8 : SCREENWIDTH;
+		bool displayOff = false;
+		ST7565R_sendPage(row, &curScreen[SCREENWIDTH * row], column * 8, x2, &displayOff, NULL);
+		if (displayOff)
+		{
+			ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+		}
+#endif
+	}
+	ST7565R_unlock();
+}
+
+void ST7565R_fillTiles(unsigned column, unsigned row, unsigned columns, unsigned rows, uint8_t tile)
+{	// The same tile in a block of cells
+	ST7565R_lock();
+	for (unsigned r = row; r < row + rows && r < SCREENPAGES; r++)
+	{
+		for (unsigned c = column; c < column + columns && c < ST7565R_TILE_COLUMNS; c++)
+		{
+			ST7565R_setTile(c, r, tile);
+		}
+	}
+	ST7565R_unlock();
+}
+
+uint8_t ST7565R_getTile(unsigned column, unsigned row)
+{
+	if (column >= ST7565R_TILE_COLUMNS || row >= SCREENPAGES) {return ST7565R_TILE_NONE;}
+	return tileMap[row][column];
+}
+
+void ST7565R_clearTiles(void)
+{	// Every cell back to ST7565R_TILE_NONE. What the tiles painted stays until something paints over it
+	ST7565R_lock();
+	memset(tileMap, ST7565R_TILE_NONE, sizeof(tileMap));
+	memset(tileDirty, 0x00, sizeof(tileDirty));
+	ST7565R_unlock();
+}
+#endif
+
+#ifdef ST7565R_GRAYSCALE
+/****************************************************
+*        GRAYSCALE FUNCTIONS		                *
+****************************************************/
+// Frame rate control: each pixel's level is two bits in two planes, and the panel is flicked through 3 subframes, the high
+// plane twice and the low plane once, so level n is dark for n of every 3. Only where the planes differ does anything change
+// between subframes, and only those bytes get sent, so a screen with a little gray on it costs a few bytes per tick.
+void ST7565R_paintGrayPixel(uint8_t level, unsigned x, unsigned y)
+{	// One pixel at a gray level (0 white - 3 black)
+	int screenX = (int)x + viewport.originX;
+	int screenY = (int)y + viewport.originY;
+	if (screenX < viewport.left || screenX >= viewport.right) 	{return;}
+	if (screenY < viewport.top  || screenY >= viewport.bottom)	{return;}
+	for (int plane = 0; plane < 2; plane++)
+	{
+		target = grayPlanes[plane];
+		ST7565R_addPixelToCurScreen((level & (1 << plane)) ? DRAW : ERASE, screenX, screenY);
+	}
+	target = curScreen;
+	ST7565R_markDirtyRegion(screenX, screenY, screenX + 1, screenY + 1);
+	ST7565R_markGraySpans(screenX, screenY, screenX + 1, screenY + 1);
+}
+
+void ST7565R_paintGrayRectangle(uint8_t level, unsigned x, unsigned y, unsigned width, unsigned height)
+{	// Fill a box with a gray level, level 0 takes the gray out of it
+	int x1 = (int)x + viewport.originX;
+	int y1 = (int)y + viewport.originY;
+	int x2 = x1 + (int)width;
+	int y2 = y1 + (int)height;
+	if (x1 < viewport.left) 	{x1 = viewport.left;}
+	if (y1 < viewport.top) 		{y1 = viewport.top;}
+	if (x2 > viewport.right) 	{x2 = viewport.right;}
+	if (y2 > viewport.bottom) 	{y2 = viewport.bottom;}
+	if (x1 >= x2 || y1 >= y2) 	{return;}
+	for (int plane = 0; plane < 2; plane++)
+	{
+		target = grayPlanes[plane];
+		ST7565R_addRectangleToCurScreen((level & (1 << plane)) ? DRAW : ERASE, x1, y1, x2, y2);
+	}
+	target = curScreen;
+	ST7565R_markGraySpans(x1, y1, x2, y2);
+}
+
+void ST7565R_paintGrayBitmap(const uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height)
+{	// A 2 bit per pixel bitmap: width * pages bytes of the levels' low bits, then the same of their high bits
+	if (bitmap == NULL) {return;}
+	int x1 = (int)x + viewport.originX;
+	int y1 = (int)y + viewport.originY;
+	int x2 = (x1 + (int)width < viewport.right) ? x1 + (int)width : viewport.right;
+	int y2 = (y1 + (int)height < viewport.bottom) ? y1 + (int)height : viewport.bottom;
+	unsigned planeBytes = width * ST7565R_num_pages_from_height(height);
+	for (int plane = 0; plane < 2; plane++)
+	{
+		target = grayPlanes[plane];
+		ST7565R_addBitmapToCurScreen(&bitmap[planeBytes * plane], x1, y1, width, height);
+	}
+	target = curScreen;
+	if (x1 < viewport.left) {x1 = viewport.left;}
+	if (y1 < viewport.top) 	{y1 = viewport.top;}
+	if (x1 < x2 && y1 < y2) {ST7565R_markGraySpans(x1, y1, x2, y2);}
+}
+
+void ST7565R_grayscaleTick(void)
+{	// Call from a timer, 150 Hz or faster (50 gray frames a second) or the gray flickers. Moves on to the next subframe and
+	// sends the bytes that look different in it. If the driver is locked, e.g. the tick interrupted an updateDisplay() part way
+	// through a page, it sends nothing and the current subframe lasts a tick longer. Without lock hooks there is no mutex to
+	// wait on, and its bytes would land in the middle of the update's
+	if (lockDepth != 0)
+	{
+		grayStats.skipped++;
+		return;
+	}
+	ST7565R_lock();
+	graySubframe = (graySubframe + 1) % ST7565R_GRAY_SUBFRAMES;
+	uint32_t left 	= UINT32_MAX;			// Only there to count the bytes sent
+	bool displayOff = true;					// Don't switch the display off, blanking it every subframe would flicker far worse
+	for (int page = 0; page < SCREENPAGES; page++)
+	{
+		const uint8_t* low 	= &grayPlanes[0][SCREENWIDTH * page];
+		const uint8_t* high = &grayPlanes[1][SCREENWIDTH * page];
+		unsigned start 		= grayStart[page];
+		unsigned end 		= grayEnd[page];
+		while (start < end && low[start] == high[start]) 	{start++;}		// Trim the span to where the planes really differ
+		while (end > start && low[end - 1] == high[end - 1]) 	{end--;}
+		grayStart[page] = start;
+		grayEnd[page] 	= end;
+		if (start == end) {continue;}
+
+		const uint8_t* cur = ST7565R_composeGrayPage(page, start, end);
+		ST7565R_sendPage(page, cur, start, end, &displayOff, &left);
+		memcpy(&lastScreen[(SCREENWIDTH * page) + start], &cur[start], end - start);
+	}
+	grayStats.lastBytes = UINT32_MAX - left;
+	if (grayStats.lastBytes > grayStats.maxBytes) {grayStats.maxBytes = grayStats.lastBytes;}
+	grayStats.ticks++;
+	ST7565R_unlock();
+}
+
+ST7565R_GrayStats ST7565R_getGrayStats(void)
+{	// What the ticks cost on the wire, and how fast they could go at ST7565R_SPI_CLOCK_HZ. Leave some room for the updates
+	ST7565R_GrayStats stats = grayStats;
+	stats.maxTickHz = (stats.maxBytes == 0) ? 0 : ST7565R_SPI_CLOCK_HZ / (8 * stats.maxBytes);
+	return stats;
+}
+#endif
+
+/****************************************************
+*        CLIP & VIEWPORT FUNCTIONS                  *
+****************************************************/
+bool ST7565R_pushClip(int x, int y, unsigned width, unsigned height)
+{	// Limit drawing to a box (in current coordinates) inside the current clip. Undo it with popClip()
+	if (viewportDepth >= ST7565R_CLIP_STACK_DEPTH) {return false;}
+	viewportStack[viewportDepth++] = viewport;
+
+	x += viewport.originX;
+	y += viewport.originY;
+	if (x > viewport.left) 					{viewport.left = x;}
+	if (y > viewport.top) 					{viewport.top = y;}
+	if (x + (int)width < viewport.right) 	{viewport.right = x + (int)width;}
+	if (y + (int)height < viewport.bottom) 	{viewport.bottom = y + (int)height;}
+	if (viewport.right < viewport.left) 	{viewport.right = viewport.left;}	// Empty, everything gets rejected
+	if (viewport.bottom < viewport.top) 	{viewport.bottom = viewport.top;}
+	return true;
+}
+
+bool ST7565R_pushViewport(int x, int y, unsigned width, unsigned height)
+{	// Same as pushClip(), and (x,y) also becomes the new (0,0) so widgets can draw without knowing where they are
+	if (!ST7565R_pushClip(x, y, width, height)) {return false;}
+	viewport.originX += x;
+	viewport.originY += y;
+	return true;
+}
+
+void ST7565R_popClip(void)
+{	// Go back to the clip and origin from before the last successful pushClip()/pushViewport()
+	if (viewportDepth == 0) {return;}
+	viewport = viewportStack[--viewportDepth];
+}
+
+void ST7565R_resetClip(void)
+{	// Drop every pushed clip and draw to the whole screen again
+	viewportDepth = 0;
+	viewport.left = 0;
+	viewport.top = drawableTop;
+	viewport.right = DRAWWIDTH;
+	viewport.bottom = drawableBottom;
+	viewport.originX = 0;
+	viewport.originY = 0;
+}
+
+
+/****************************************************
+*        LOCKING FUNCTIONS                          *
+****************************************************/
+void ST7565R_setLockHooks(ST7565R_LockHook lock, ST7565R_LockHook unlock, void* context)
+{	// Give the driver a recursive mutex to take and give back. Set it before any other task starts drawing
+	lockHook = lock;
+	unlockHook = unlock;
+	lockContext = context;
+}
+
+void ST7565R_lock(void)
+{	// Take the driver for this task, e.g. around a screen's worth of paint calls. Nests
+	if (lockHook != NULL)
+	{
+		lockHook(lockContext);
+	}
+#if defined(ST7565R_GRAYSCALE) || defined(ST7565R_SCRUB)
+	ST7565R_critical_enter();
+	lockDepth++;
+	ST7565R_critical_exit();
+#endif
+}
+
+void ST7565R_unlock(void)
+{
+#if defined(ST7565R_GRAYSCALE) || defined(ST7565R_SCRUB)
+	ST7565R_critical_enter();
+	lockDepth--;
+	ST7565R_critical_exit();
+#endif
+	if (unlockHook != NULL)
+	{
+		unlockHook(lockContext);
+	}
+}
+
+
+#ifdef ST7565R_TRACE
+/****************************************************
+*        TRACE FUNCTIONS                            *
+****************************************************/
+void ST7565R_setTraceSink(ST7565R_TraceSink sink, void* context)
+{	// Start a new trace into sink, or stop with NULL. Whatever the last sink hasn't been given yet goes to it first
+	ST7565R_traceFlush();
+	traceSink = sink;
+	traceContext = context;
+	if (sink == NULL) {return;}
+
+	uint32_t clockHz = ST7565R_TRACE_CLOCK_HZ;
+	uint8_t header[9] = {'S', '7', 'T', 'R', ST7565R_TRACE_VERSION,
+		(uint8_t)clockHz, (uint8_t)(clockHz >> 8), (uint8_t)(clockHz >> 16), (uint8_t)(clockHz >> 24)};
+	sink(header, sizeof(header), context);
+	traceLast = ST7565R_trace_clock();
+}
+
+void ST7565R_traceFlush(void)
+{	// Hand the sink everything recorded so far, e.g. before reading a RAM trace out or powering down
+	if (traceSink != NULL && traceUsed != 0)
+	{
+		traceSink(traceBuffer, traceUsed, traceContext);
+	}
+	traceUsed = 0;
+}
+
+static void ST7565R_traceBytes(bool data, const uint8_t* bytes, unsigned count){
+	// Record one Chip Select period: a control byte (A0, carries on, count - 1), the ticks since the last period as a
+	// LEB128 varint, then the bytes. Periods longer than a record are split, the later records marked as carrying on
+	if (traceSink == NULL) {return;}
+	uint32_t now 	= ST7565R_trace_clock();
+	uint32_t delta 	= now - traceLast;
+	uint8_t flags 	= data ? 0x80 : 0x00;
+	traceLast 		= now;
+
+	while (count > 0)
+	{
+		unsigned n = (count < ST7565R_TRACE_RECORD_MAX) ? count : ST7565R_TRACE_RECORD_MAX;
+		if (traceUsed + 6 + n > ST7565R_TRACE_BUFFER) {ST7565R_traceFlush();}	// Control byte, up to 5 varint bytes, data
+
+		traceBuffer[traceUsed++] = flags | (uint8_t)(n - 1);
+		do
+		{
+			traceBuffer[traceUsed++] = (uint8_t)((delta & 0x7F) | ((delta > 0x7F) ? 0x80 : 0x00));
+			delta >>= 7;
+		} while (delta != 0);
+		memcpy(&traceBuffer[traceUsed], bytes, n);
+		traceUsed 	+= n;
+		bytes 		+= n;
+		count 		-= n;
+		flags 		|= 0x40;								// The rest carries on this Chip Select period
+	}
+}
+#endif
+
+
+/****************************************************
+*        NUMBER FUNCTIONS                           *
+****************************************************/
+void ST7565R_paintInt(int32_t value, int x, int y, int8_t width, char pad)
+{	// Paint an integer, see paintFixed(). DON'T FORGET TO updateDisplay()
+	ST7565R_paintFixed(value, 0, x, y, width, pad);
+}
+
+void ST7565R_paintFixed(int32_t value, uint8_t decimals, int x, int y, int8_t width, char pad)
+{	// Paint value / 10^decimals, e.g. (1234, 2) paints 12.34. The characters come straight out of the digit strip, and
+	// when the last number painted at (x,y) is still on the screen only the characters that differ get repainted.
+	// Anything else drawn over a number makes the driver forget it, so the next one is painted in full.
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {.type = COMMAND_NUMBER, .param = {decimals | ((pad == '0') ? 0x80 : 0x00), (uint8_t)width}, .data.number = value};
+	ST7565R_listAdd(&command, x + viewport.originX, y + viewport.originY, viewport.right - (x + viewport.originX), curFont.height);
+	return;
+#endif
+	uint8_t chars[ST7565R_NUMBER_MAX_CHARS];
+	unsigned length 	= ST7565R_formatNumber(chars, value, decimals, width, pad);
+	unsigned charWidth 	= ST7565R_numberCharWidth();
+	int screenX 		= x + viewport.originX;
+	int screenY 		= y + viewport.originY;
+	bool inside 		= screenX >= viewport.left && screenY >= viewport.top &&
+						  screenX + (int)(length * charWidth) <= viewport.right && screenY + curFont.height <= viewport.bottom;
+#ifdef ST7565R_STRIP_MODE
+	inside = false;			// Every page starts out blank, so there's nothing to remember between updates
+#endif
+
+	ST7565R_NumberCache* entry = NULL;
+	for (int i = 0; i < ST7565R_NUMBER_CACHE_SIZE; i++)
+	{
+		ST7565R_NumberCache* candidate = &numberCache[i];
+		if (candidate->length != 0 && candidate->x == screenX && candidate->y == screenY && candidate->font == ST7565R_fontIdentity(&curFont))
+		{
+			entry = candidate;
+			break;
+		}
+	}
+	if (!inside && entry != NULL)
+	{	// Only numbers painted whole are remembered, part of this one is clipped off
+		entry->length = 0;
+		entry = NULL;
+	}
+	else if (entry == NULL && inside)
+	{	// Take over the oldest entry
+		entry = &numberCache[numberCacheNext];
+		numberCacheNext = (numberCacheNext + 1) % ST7565R_NUMBER_CACHE_SIZE;
+		entry->x = screenX;
+		entry->y = screenY;
+		entry->font = ST7565R_fontIdentity(&curFont);
+		entry->charWidth = charWidth;
+		entry->height = curFont.height;
+		entry->length = 0;
+	}
+
+	numberBeingPainted = entry;
+#ifdef PAINT_IMMEDIATELY
+	int first = -1;
+	int last = -1;
+#endif
+	unsigned total = (entry != NULL && entry->length > length) ? entry->length : length;
+	for (unsigned i = 0; i < total; i++)
+	{	// Characters past the end of the new number blank out what's left of a longer old one
+		uint8_t index = (i < length) ? chars[i] : ST7565R_NUMBER_SPACE;
+		if (entry != NULL && i < entry->length && entry->chars[i] == index) {continue;}
+		ST7565R_addNumberCharToCurScreen(index, screenX + (int)(i * charWidth), screenY);
+#ifdef PAINT_IMMEDIATELY
+		if (first < 0) {first = i;}
+		last = i;
+#endif
+	}
+	if (entry != NULL)
+	{
+		memcpy(entry->chars, chars, length);
+		entry->length = length;
+	}
+	numberBeingPainted = NULL;
+
+#ifdef PAINT_IMMEDIATELY
+	if (first >= 0)
+	{
+		ST7565R_paintRegion(screenX + (first * (int)charWidth), screenY, (last - first + 1) * charWidth, curFont.height);
+	}
+#endif
+}
+
+unsigned ST7565R_numberCharWidth(void)
+{	// Columns each character of paintInt()/paintFixed() takes in the current font. Digits are all this wide (tabular)
+	return ST7565R_digitWidth(&curFont);
+}
+
+
+/****************************************************
+*   FUNCTIONS NOT TO BE REFERENCED OUTSIDE DRIVER   *
+****************************************************/
+#if !defined(PAINT_IMMEDIATELY) && !defined(ST7565R_STRIP_MODE) && !defined(ST7565R_FRAME_HANDOFF) && !defined(ST7565R_DISPLAY_LIST)
+static bool ST7565R_flushCurScreen(uint32_t budget){
+	// Send everything in the dirty spans that differs from lastScreen, and record it in lastScreen. Only the dirty spans
+	// can differ, everything else already matches. Pages go most recently dirtied first, and once budget bytes are sent
+	// what's left of the spans stays dirty. Returns whether everything got sent
+	uint16_t order[SCREENPAGES];
+	unsigned numDirty = 0;
+	for (int page = 0; page < SCREENPAGES; page++)
+	{	// Insertion sort, newest stamp first
+		if (dirtyStart[page] == dirtyEnd[page]) {continue;}
+		unsigned i = numDirty++;
+		for (; i > 0 && dirtyStamp[order[i - 1]] < dirtyStamp[page]; i--) {order[i] = order[i - 1];}
+		order[i] = page;
+	}
+
+	uint32_t left 		= budget;
+	bool displayOff 	= false;
+	bool complete 		= true;
+	for (unsigned i = 0; i < numDirty; i++)
+	{
+		unsigned page 		= order[i];
+		unsigned start 		= dirtyStart[page];
+		unsigned end 		= dirtyEnd[page];
+		const uint8_t* cur 	= &curScreen[SCREENWIDTH * page];
+#ifdef ST7565R_SPRITES
+		if (spriteList != NULL) {cur = ST7565R_composePage(page, start, end);}
+#endif
+#ifdef ST7565R_GRAYSCALE
+		cur = ST7565R_composeGrayPage(page, start, end);
+#endif
+		unsigned sent = ST7565R_sendPage(page, cur, start, end, &displayOff, &left);
+		memcpy(&lastScreen[(SCREENWIDTH * page) + start], &cur[start], sent - start);
+		if (sent == end)
+		{
+			dirtyStart[page] = 0;
+			dirtyEnd[page] = 0;
+		}
+		else
+		{
+			dirtyStart[page] = sent;
+			complete = false;
+		}
+	}
+	if (displayOff)
+	{
+		ST7565R_command(ST7565R_CMD_DISPLAY_ON);			// Set Display ON, sendPage() kept a byte of the budget for it
+	}
+
+	flushStats.lastBudget 	= budget;
+	flushStats.lastBytes 	= budget - left;
+	if (flushStats.lastBytes > flushStats.maxBytes) {flushStats.maxBytes = flushStats.lastBytes;}
+	if (!complete) {flushStats.carriedOver++;}
+
+#ifndef RETAIN_CURSCREEN
+	if (complete)
+	{	// Only once the whole frame is out, so keep calling a budgeted update without painting until it returns true
+		memset(curScreen, 0x00, SCREENBYTES);	// Reset the current screen data-structure, which may now differ anywhere
+		ST7565R_markDirtyRegion(0, 0, DRAWWIDTH, DRAWHEIGHT);
+#ifdef ST7565R_TILE_MAP
+		ST7565R_invalidateTiles();
+#endif
+	}
+#endif
+	return complete;
+}
+#endif
+
+#ifndef ST7565R_STRIP_MODE
+static unsigned ST7565R_sendPage(unsigned page, const uint8_t* cur, unsigned start, unsigned end, bool* displayOff, uint32_t* budget){
+	// Send the columns start to end of one page that differ from lastScreen, switching the display off first if it isn't
+	// already. Changed bytes are sent in runs: the column auto-increments, so a run only needs its start address. Gaps of
+	// a couple of unchanged bytes are cheaper to resend than the two column commands needed to skip them.
+	// With a budget (bytes left, NULL for none) runs are cut short once it's spent, counting every command, and a byte is
+	// kept back for the caller's DISPLAY_ON. Returns the first column not sent, end once the whole span is done
+	unsigned column 	= start;
+	bool pageSet 		= false;
+
+	while (column < end)
+	{
+#ifndef PAINT_IMMEDIATELY
+		const uint8_t* last = &lastScreen[SCREENWIDTH * page];
+		if (cur[column] == last[column])
+		{	// Only paint if there's something new
+			column++;
+			continue;
+		}
+		unsigned runEnd = column + 1;
+		unsigned scan = runEnd;
+		while (scan < end && scan - runEnd <= ST7565R_RUN_GAP)
+		{	// Grow the run while changes keep turning up within a small gap
+			if (cur[scan] != last[scan]) {runEnd = scan + 1;}
+			scan++;
+		}
+#else
+		unsigned runEnd = end;
+#endif
+		if (budget != NULL)
+		{	// Column address, plus the page address and DISPLAY_OFF/ON the first time round, then at least one byte
+			uint32_t overhead = 2 + (pageSet ? 0 : 1) + (*displayOff ? 0 : 2);
+			if (*budget <= overhead) {break;}
+			if (runEnd - column > *budget - overhead) {runEnd = column + (*budget - overhead);}
+			*budget -= overhead + (runEnd - column);
+		}
+		if (!*displayOff)
+		{
+			ST7565R_command(ST7565R_CMD_DISPLAY_OFF);
+			*displayOff = true;
+		}
+		if (!pageSet)
+		{
+			ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(page));
+			pageSet = true;
+		}
+		ST7565R_command(ST7565R_CMD_COLUMN_MSB(column / 0x10));		// Specify which column to draw to, upper 4 bits + 0x10
+		ST7565R_command(ST7565R_CMD_COLUMN_LSB(column % 0x10));		// Specify which column to draw to, lower 4 bits + 0x00
+		ST7565R_paintBytesHere(&cur[column], runEnd - column);		// Send the run
+		column = runEnd;
+	}
+	return column;
+}
+#endif
+
+#ifdef ST7565R_TILE_MAP
+static void ST7565R_paintTileRow(int page, bool dirtyOnly){
+	// Copy a page's tile cells into the target, each one a single memcpy. Either just the cells changed since the last
+	// time (curScreen keeps them), or all of them (strips and the display list start every page blank)
+	uint8_t* dest 	= ST7565R_targetPage(page);
+	int first 		= -1;
+	int last 		= -1;
+	for (unsigned column = 0; column < ST7565R_TILE_COLUMNS; column++)
+	{
+		uint8_t tile = tileMap[page][column];
+		if (dirtyOnly && (tileDirty[page][column / 8] & (0b00000001 << (column % 8))) == 0) {continue;}
+		if (tile == ST7565R_TILE_NONE || tileset == NULL || tile >= tilesetCount) {continue;}
+		unsigned x 		= column * 8;
+		unsigned width 	= (x + 8 < SCREENWIDTH) ? 8 : SCREENWIDTH - x;
+		memcpy(&dest[x], &tileset[tile * 8], width);
+		if (first < 0) {first = x;}
+		last = x + width;
+	}
+	memset(tileDirty[page], 0x00, sizeof(tileDirty[page]));
+	if (first >= 0)
+	{
+		ST7565R_markDirtyRegion(first, page * 8, last, (page * 8 + 8 < SCREENHEIGHT) ? page * 8 + 8 : SCREENHEIGHT);
+	}
+}
+
+#if !defined(ST7565R_STRIP_MODE) && !defined(ST7565R_DISPLAY_LIST)
+static void ST7565R_paintChangedTiles(void){
+	// Copy the changed cells into curScreen before an update
+	for (int page = 0; page < SCREENPAGES; page++)
+	{
+		ST7565R_paintTileRow(page, true);
+	}
+}
+#endif
+
+static void ST7565R_invalidateTiles(void){
+	// Copy every tile cell in again on the next update
+	memset(tileDirty, 0xFF, sizeof(tileDirty));
+}
+#endif
+
+#ifdef ST7565R_SPRITES
+static void ST7565R_markSpriteDirty(const ST7565R_Sprite* sprite){
+	// Make the next update compare a sprite's box. Doesn't forget numbers, curScreen underneath is untouched
+	int x1 = (sprite->x < 0) ? 0 : sprite->x;
+	int y1 = (sprite->y < 0) ? 0 : sprite->y;
+	int x2 = sprite->x + sprite->width;
+	int y2 = sprite->y + sprite->height;
+	if (x2 > SCREENWIDTH) 	{x2 = SCREENWIDTH;}
+	if (y2 > SCREENHEIGHT) 	{y2 = SCREENHEIGHT;}
+	if (!sprite->visible || x1 >= x2 || y1 >= y2) {return;}
+	ST7565R_markDirtySpans(x1, y1, x2, y2);
+}
+
+static const uint8_t* ST7565R_composePage(int page, unsigned start, unsigned end){
+	// Columns start to end of one page of curScreen with the visible sprites on top, bottom sprite first. Sprite bytes
+	// are shifted into place like addBitmapToCurScreen(), then each byte ANDs the mask out and ORs the bitmap in
+	memcpy(&spritePage[start], &curScreen[(SCREENWIDTH * page) + start], end - start);
+	for (const ST7565R_Sprite* sprite = spriteList; sprite != NULL; sprite = sprite->next)
+	{
+		int x1 			= (sprite->x > (int)start) ? sprite->x : (int)start;
+		int x2 			= ((sprite->x + sprite->width) < (int)end) ? (sprite->x + sprite->width) : (int)end;
+		int rowTop 		= (page * 8 > sprite->y) ? page * 8 : sprite->y;
+		int rowBottom 	= (page * 8 + 8 < sprite->y + sprite->height) ? page * 8 + 8 : sprite->y + sprite->height;
+		if (!sprite->visible || sprite->bitmap == NULL || x1 >= x2 || rowTop >= rowBottom) {continue;}
+		uint8_t rows 	= (uint8_t)((0xFF << (rowTop - page * 8)) & (0xFF >> (8 - (rowBottom - page * 8))));
+
+		int srcPages 	= ST7565R_num_pages_from_height(sprite->height);
+		int srcRow 		= (page * 8) - sprite->y;			// Sprite row that lands on bit 0 of this page
+		int srcPage 	= ((srcRow + 8) / 8) - 1;			// Floor division, srcRow is never below -7
+		int shift 		= srcRow - (srcPage * 8);
+		int upper 		= (srcPage >= 0) ? (sprite->width * srcPage) + (x1 - sprite->x) : -1;
+		int lower 		= (srcPage + 1 < srcPages && shift != 0) ? (sprite->width * (srcPage + 1)) + (x1 - sprite->x) : -1;
+		const uint8_t* mask = (sprite->mask != NULL) ? sprite->mask : sprite->bitmap;
+		uint8_t* dest 	= &spritePage[x1];
+
+		for (int i = 0; i < x2 - x1; i++)
+		{
+			uint8_t bits = 0;
+			uint8_t opaque = 0;
+			if (upper >= 0) {bits  = sprite->bitmap[upper + i] >> shift;			opaque  = mask[upper + i] >> shift;}
+			if (lower >= 0) {bits |= sprite->bitmap[lower + i] << (8 - shift);	opaque |= mask[lower + i] << (8 - shift);}
+			if (sprite->mode == SPRITE_XOR)
+			{
+				dest[i] ^= bits & rows;
+			}
+			else
+			{
+				opaque &= rows;
+				dest[i] = (dest[i] & ~opaque) | (bits & opaque);
+			}
+		}
+	}
+	return spritePage;
+}
+#endif
+
+#ifdef ST7565R_GRAYSCALE
+static void ST7565R_markGraySpans(int x1, int y1, int x2, int y2){
+	// Grow each covered page's gray span to include columns x1 to x2. Takes an on-screen, non-empty box
+	for (int page = y1 / 8; page <= (y2 - 1) / 8; page++)
+	{
+		if (grayStart[page] == grayEnd[page])
+		{
+			grayStart[page] = x1;
+			grayEnd[page] = x2;
+			continue;
+		}
+		if (x1 < grayStart[page]) 	{grayStart[page] = x1;}
+		if (x2 > grayEnd[page]) 	{grayEnd[page] = x2;}
+	}
+}
+
+static const uint8_t* ST7565R_composeGrayPage(int page, unsigned start, unsigned end){
+	// Columns start to end of one page of curScreen ORed over the current subframe's plane: the high plane for the
+	// first two subframes, the low one for the last
+	const uint8_t* plane 	= &grayPlanes[(graySubframe < 2) ? 1 : 0][SCREENWIDTH * page];
+	const uint8_t* cur 		= &curScreen[SCREENWIDTH * page];
+	for (unsigned column = start; column < end; column++)
+	{
+		grayPage[column] = cur[column] | plane[column];
+	}
+	return grayPage;
+}
+#endif
+
+static uint8_t* ST7565R_targetPage(int page){
+	// Start of a page in whatever the rasterizers are drawing into
+	return &target[SCREENWIDTH * (page - targetFirstPage)];
+}
+
+static void ST7565R_markDirtyRegion(int x1, int y1, int x2, int y2){
+	// Something is being painted into curScreen here. Takes an on-screen, non-empty box, as the paint functions see the screen
+	ST7565R_forgetNumbers(x1, y1, x2, y2);
+#ifdef ST7565R_PORTRAIT
+	ST7565R_physicalBox(&x1, &y1, &x2, &y2);
+#endif
+	ST7565R_markDirtySpans(x1, y1, x2, y2);
+}
+
+static void ST7565R_markDirtySpans(int x1, int y1, int x2, int y2){
+	// Grow each covered page's dirty span to include columns x1 to x2. Takes an on-screen, non-empty box
+	dirtyClock++;
+	for (int page = y1 / 8; page <= (y2 - 1) / 8; page++)
+	{
+		dirtyStamp[page] = dirtyClock;
+		if (dirtyStart[page] == dirtyEnd[page])
+		{
+			dirtyStart[page] = x1;
+			dirtyEnd[page] = x2;
+			continue;
+		}
+		if (x1 < dirtyStart[page]) 	{dirtyStart[page] = x1;}
+		if (x2 > dirtyEnd[page]) 	{dirtyEnd[page] = x2;}
+	}
+}
+
+static void ST7565R_paintStringAt(const char* string, int x, int y, unsigned scale){
+	// paintStringScaled() in screen coordinates
+	int originalX 		= x;
+	int cursorX 		= x;
+	int cursorY 		= y;
+	const char* next 	= string;
+
+	while (*next != '\0')
+	{
+		uint32_t codepoint = ST7565R_decodeUTF8(&next);
+
+		// Special Characters
+		switch (codepoint)
+		{
+		case '\n': // New Line
+			cursorY += (renderFont->height + 1) * scale;
+			continue;
+		case '\r': // Carriage Return
+			cursorX = originalX;
+			continue;
+		case '\t': // Tab
+			cursorX += 2 * renderFont->width * scale;
+			continue;
+		}
+
+		unsigned glyph = ST7565R_glyphIndex(renderFont, codepoint);
+		ST7565R_paintGlyph(glyph, cursorX, cursorY, scale);
+		if (renderFont->glyphTable != NULL)
+		{	// Proportional fonts advance by each glyph's own width
+			cursorX += renderFont->glyphTable[glyph].advance * scale;
+			continue;
+		}
+		cursorX += renderFont->width * scale;
+	}
+}
+
+static void ST7565R_paintStringBoxAt(const char* string, int x, int y, unsigned width, unsigned height, ST7565R_Align align, bool wrap){
+	// paintStringBox() in screen coordinates
+	ST7565R_Viewport saved = *renderClip;
+	if (x > renderClip->left) 					{renderClip->left = x;}
+	if (y > renderClip->top) 					{renderClip->top = y;}
+	if (x + (int)width < renderClip->right) 	{renderClip->right = x + (int)width;}
+	if (y + (int)height < renderClip->bottom) 	{renderClip->bottom = y + (int)height;}
+
+	const char* next = string;
+	int lineY = y;
+	while (*next != '\0' && lineY < renderClip->bottom)
+	{	// Find where this line ends and how wide it is
+		const char* lineStart 	= next;
+		const char* lineEnd 	= next;
+		const char* breakAt 	= NULL;				// Last space on the line, where a word wrap can happen
+		unsigned lineWidth 		= 0;
+		unsigned breakWidth 	= 0;
+
+		while (*next != '\0')
+		{
+			const char* here = next;
+			uint32_t codepoint = ST7565R_decodeUTF8(&next);
+			if (codepoint == '\n')
+			{	// Hard line break
+				lineEnd = here;
+				break;
+			}
+			if (codepoint == '\r') {continue;}
+
+			unsigned advance = ST7565R_codepointAdvance(renderFont, codepoint);
+			if (wrap && lineWidth > 0 && lineWidth + advance > width)
+			{	// Doesn't fit, wrap at the last space or failing that right here
+				if (breakAt != NULL)
+				{
+					lineEnd 	= breakAt;
+					lineWidth 	= breakWidth;
+					next 		= breakAt + 1;
+				}
+				else
+				{
+					lineEnd = here;
+					next 	= here;
+				}
+				break;
+			}
+			if (codepoint == ' ')
+			{
+				breakAt 	= here;
+				breakWidth 	= lineWidth;
+			}
+			lineWidth += advance;
+			lineEnd = next;
+		}
+
+		int lineX = x;
+		if (align == ALIGN_CENTER)		{lineX += ((int)width - (int)lineWidth) / 2;}
+		else if (align == ALIGN_RIGHT)	{lineX += (int)width - (int)lineWidth;}
+
+		const char* cursor = lineStart;
+		while (cursor < lineEnd && lineX < renderClip->right)
+		{	// Paint the line, anything left of the box costs a table lookup and nothing more
+			uint32_t codepoint = ST7565R_decodeUTF8(&cursor);
+			if (codepoint == '\r') {continue;}
+			unsigned advance = ST7565R_codepointAdvance(renderFont, codepoint);
+			if (codepoint != ' ' && codepoint != '\t' && lineX + (int)advance > renderClip->left)
+			{
+				ST7565R_paintGlyph(ST7565R_glyphIndex(renderFont, codepoint), lineX, lineY, 1);
+			}
+			lineX += advance;
+		}
+		lineY += renderFont->height + 1;
+	}
+
+	*renderClip = saved;
+}
+
+#ifdef ST7565R_FRAME_HANDOFF
+static void ST7565R_submitFrame(void){
+	// Publish curScreen as the newest frame and carry on drawing in whichever buffer was waiting in between. If the
+	// display task hadn't taken that one yet it's simply dropped, the newest frame wins. Never waits on anything.
+	uint8_t published = frameBack;
+	frameBack = atomic_exchange(&frameShared, published | ST7565R_FRAME_FRESH) & ~ST7565R_FRAME_FRESH;
+	curScreen = frames[frameBack];
+	target = curScreen;
+#ifdef RETAIN_CURSCREEN
+	memcpy(curScreen, frames[published], SCREENBYTES);		// Only read by the display task, so copying it is safe
+#else
+	memset(curScreen, 0x00, SCREENBYTES);
+#ifdef ST7565R_TILE_MAP
+	ST7565R_invalidateTiles();
+#endif
+#endif
+	for (int page = 0; page < SCREENPAGES; page++)
+	{	// flushFrame() compares whole frames, the spans only need resetting
+		dirtyStart[page] = 0;
+		dirtyEnd[page] = 0;
+	}
+#ifndef RETAIN_CURSCREEN
+	ST7565R_markDirtyRegion(0, 0, DRAWWIDTH, DRAWHEIGHT);	// Numbers painted before are gone
+#endif
+}
+#endif
+
+#ifdef ST7565R_STRIP_MODE
+static void ST7565R_renderStrips(void){
+	// Draw the screen a page at a time: clear a strip, let the callback paint into it with everything clipped to that page,
+	// and send it. With two strips the page just drawn goes out in the background while the callback draws the next one.
+	unsigned buffer = 0;
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+	bool sending = false;
+#endif
+
+	ST7565R_command(ST7565R_CMD_DISPLAY_OFF);
+	for (int page = 0; page < SCREENPAGES; page++)
+	{
+		target 			= stripBuffers[buffer];
+		targetFirstPage = page;
+		drawableTop 	= page * 8;
+		drawableBottom 	= (page * 8 + 8 < SCREENHEIGHT) ? page * 8 + 8 : SCREENHEIGHT;
+		ST7565R_resetClip();
+		memset(target, 0x00, SCREENWIDTH);
+#ifdef ST7565R_TILE_MAP
+		ST7565R_paintTileRow(page, false);		// Under everything the callback draws
+#endif
+		if (drawCallback != NULL)
+		{
+			drawCallback(page, drawContext);
+		}
+
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+		if (sending)
+		{	// The bus is still busy with the last page
+			ST7565R_waitForBytes();
+		}
+#endif
+		ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(page));
+		ST7565R_command(ST7565R_CMD_COLUMN_MSB(0));
+		ST7565R_command(ST7565R_CMD_COLUMN_LSB(0));
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+		ST7565R_paintBytesHereAsync(target, SCREENWIDTH);
+		sending = true;
+		buffer ^= 1;
+#else
+		ST7565R_paintBytesHere(target, SCREENWIDTH);
+#endif
+	}
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+	if (sending)
+	{
+		ST7565R_waitForBytes();
+	}
+#endif
+	ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+
+	drawableTop = 0;		// Nothing can be drawn until the next update
+	drawableBottom = 0;
+	ST7565R_resetClip();
+}
+
+#ifdef ST7565R_STRIP_DOUBLE_BUFFER
+static void ST7565R_paintBytesHereAsync(const uint8_t* bytes, unsigned count){
+	// Start sending data bytes and return straight away. Chip Select stays low until waitForBytes()
+	ST7565R_digital_write(NHD_CS, LOW);
+	ST7565R_digital_write(NHD_A0, HIGH);
+#ifdef ST7565R_TRACE
+	ST7565R_traceBytes(true, bytes, count);
+#endif
+	ST7565R_spi_transmit_buffer_async(bytes, count);
+}
+
+static void ST7565R_waitForBytes(void){
+	// Wait for paintBytesHereAsync() to finish and end the transmission
+	ST7565R_spi_wait();
+	ST7565R_digital_write(NHD_CS, HIGH);
+}
+#endif
+#endif
+
+#ifdef ST7565R_DISPLAY_LIST
+static void ST7565R_listAdd(ST7565R_Command* command, int x, int y, unsigned width, unsigned height){
+	// Queue a command that paints inside the box (x,y,width,height) in screen coordinates, trimmed to the clip
+	command->x 		= x;
+	command->y 		= y;
+	command->width 	= width;
+	command->height = height;
+	if (!ST7565R_listBounds(command, x, y, width, height)) {return;}	// Nothing to paint
+	ST7565R_listPush(command);
+}
+
+static bool ST7565R_listBounds(ST7565R_Command* command, int x, int y, unsigned width, unsigned height){
+	// Set the bounds a command paints inside, the box (x,y,width,height) trimmed to the clip. False when that's nothing.
+	// For commands whose position fields hold something other than their box, like shapes
+	int x2 = x + (int)width;
+	int y2 = y + (int)height;
+	command->left 	= (x < viewport.left) ? viewport.left : x;
+	command->top 	= (y < viewport.top) ? viewport.top : y;
+	command->right 	= (x2 > viewport.right) ? viewport.right : x2;
+	command->bottom = (y2 > viewport.bottom) ? viewport.bottom : y2;
+	return command->left < command->right && command->top < command->bottom;
+}
+
+static void ST7565R_listPush(ST7565R_Command* command){
+	// Copy a command into the ring buffer. Interrupts are held off for the copy, so this is safe from an ISR
+	ST7565R_critical_enter();
+	uint8_t next = (listHead + 1) % ST7565R_DISPLAY_LIST_SIZE;
+	bool queued = false;
+	if (next != listTail)
+	{
+		bool text = command->type == COMMAND_GLYPH || command->type == COMMAND_STRING ||
+					command->type == COMMAND_STRING_BOX || command->type == COMMAND_NUMBER;
+		uint8_t slot = 0;
+		if (text)
+		{	// Text needs the font it was queued with
+			while (slot < listNumFonts && ST7565R_fontIdentity(&listFonts[slot]) != ST7565R_fontIdentity(&curFont)) {slot++;}
+			if (slot == listNumFonts && listNumFonts < ST7565R_DISPLAY_LIST_FONTS) {listFonts[listNumFonts++] = curFont;}
+		}
+		if (!text || slot < listNumFonts)
+		{
+			command->font = slot;
+			displayList[listHead] = *command;
+			listHead = next;
+			queued = true;
+		}
+	}
+	if (!queued) {listDropped++;}
+	ST7565R_critical_exit();
+}
+
+static void ST7565R_runDisplayList(void){
+	// Draw the queued commands one page at a time into pageStrip and send each page. Commands are visited in the order
+	// they were queued, skipping the ones that miss the page and the ones a later opaque command covers on this page.
+	// The rasterizers get a clip and font of their own, so viewport and curFont stay the caller's for anything queued meanwhile
+	ST7565R_Viewport commandClip;
+	uint8_t end 					= listHead;		// Commands queued while drawing wait for the next update
+	bool displayOff 				= false;
+	renderClip 						= &commandClip;
+
+	for (int page = 0; page < SCREENPAGES; page++)
+	{
+		int top 		= page * 8;
+		int bottom 		= (top + 8 < SCREENHEIGHT) ? top + 8 : SCREENHEIGHT;
+		target 			= pageStrip;
+		targetFirstPage = page;
+		memset(pageStrip, 0x00, SCREENWIDTH);
+#ifdef ST7565R_TILE_MAP
+		ST7565R_paintTileRow(page, false);			// Under every command
+#endif
+
+		for (uint8_t i = listTail; i != end; i = (i + 1) % ST7565R_DISPLAY_LIST_SIZE)
+		{
+			const ST7565R_Command* command = &displayList[i];
+			if (command->bottom <= top || command->top >= bottom) 	{continue;}
+			if (ST7565R_isOccluded(i, end, top, bottom)) 			{continue;}
+
+			// Clip to the command's bounds on this page, so nothing can land outside the strip
+			commandClip.left 		= command->left;
+			commandClip.right 		= command->right;
+			commandClip.top 		= (command->top > top) ? command->top : top;
+			commandClip.bottom 		= (command->bottom < bottom) ? command->bottom : bottom;
+			commandClip.originX 	= 0;
+			commandClip.originY 	= 0;
+			ST7565R_runCommand(command);
+		}
+
+		ST7565R_sendPage(page, pageStrip, 0, SCREENWIDTH, &displayOff, NULL);
+		memcpy(&lastScreen[SCREENWIDTH * page], pageStrip, SCREENWIDTH);
+	}
+	if (displayOff)
+	{
+		ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+	}
+
+	ST7565R_critical_enter();
+	listTail = end;
+	if (listTail == listHead) {listNumFonts = 0;}		// Otherwise commands queued meanwhile still need their fonts
+	ST7565R_critical_exit();
+	renderClip 		= &viewport;
+	renderFont 		= &curFont;
+	targetFirstPage = 0;
+}
+
+static void ST7565R_runCommand(const ST7565R_Command* command){
+	// Draw one queued command into the strip, through the same rasterizers the other modes use
+	if (command->type == COMMAND_GLYPH || command->type == COMMAND_STRING ||
+		command->type == COMMAND_STRING_BOX || command->type == COMMAND_NUMBER)
+	{
+		renderFont = &listFonts[command->font];
+	}
+
+	switch (command->type)
+	{
+	case COMMAND_BYTE:
+		ST7565R_targetPage(command->y / 8)[command->x] = (uint8_t)command->data.number;
+		break;
+	case COMMAND_PIXEL:
+		ST7565R_addPixelToCurScreen(command->param[0], command->x, command->y);
+		break;
+	case COMMAND_GLYPH:		// param[1] is the scale, 0 from the commands that don't have one
+		ST7565R_addGlyphScaled(command->data.number, command->x, command->y, command->param[1]);
+		break;
+	case COMMAND_STRING:
+		ST7565R_paintStringAt(command->data.string, command->x, command->y, (command->param[1] > 1) ? command->param[1] : 1);
+		break;
+	case COMMAND_STRING_BOX:
+		ST7565R_paintStringBoxAt(command->data.string, command->x, command->y, command->width, command->height, command->param[0], command->param[1]);
+		break;
+	case COMMAND_BITMAP:
+	{	// Queued with the scaled size
+		unsigned scale = (command->param[1] > 1) ? command->param[1] : 1;
+		ST7565R_addBitmapScaled(command->data.bitmap, command->x, command->y, command->width / scale, command->height / scale, scale);
+		break;
+	}
+	case COMMAND_ASSET:
+		ST7565R_addAssetToCurScreen(command->data.asset, command->param[0] | (command->param[1] << 8), command->x, command->y);
+		break;
+	case COMMAND_RECTANGLE:
+		ST7565R_addRectangleToCurScreen(command->param[0], renderClip->left, renderClip->top, renderClip->right, renderClip->bottom);
+		break;
+	case COMMAND_CIRCLE:
+		ST7565R_addCircleToCurScreen(command->param[0], command->x, command->y, command->width, command->param[1],
+									 command->data.point[0], command->data.point[1]);
+		break;
+	case COMMAND_TRIANGLE:
+	{
+		int16_t points[6] = {command->x, command->y, (int16_t)command->width, (int16_t)command->height, command->data.point[0], command->data.point[1]};
+		ST7565R_addPolygonToCurScreen(command->param[0], points, 3, 0, 0);
+		break;
+	}
+	case COMMAND_POLYGON:
+		ST7565R_addPolygonToCurScreen(command->param[0], command->data.points, command->width, command->x, command->y);
+		break;
+	case COMMAND_NUMBER:
+	{	// Nothing is retained between updates, so every character gets painted
+		uint8_t chars[ST7565R_NUMBER_MAX_CHARS];
+		char pad 			= (command->param[0] & 0x80) ? '0' : ' ';
+		unsigned length 	= ST7565R_formatNumber(chars, command->data.number, command->param[0] & 0x7F, (int8_t)command->param[1], pad);
+		unsigned charWidth 	= ST7565R_digitWidth(renderFont);
+		for (unsigned i = 0; i < length; i++)
+		{
+			ST7565R_addNumberCharToCurScreen(chars[i], command->x + (int)(i * charWidth), command->y);
+		}
+		break;
+	}
+	}
+}
+
+static bool ST7565R_isOccluded(uint8_t index, uint8_t end, int top, int bottom){
+	// Whether a command queued after this one paints over all of it on this page. Bitmaps, assets and rectangles replace
+	// everything inside their bounds, so anything they completely cover doesn't need drawing at all.
+	const ST7565R_Command* command = &displayList[index];
+	int commandTop 		= (command->top > top) ? command->top : top;
+	int commandBottom 	= (command->bottom < bottom) ? command->bottom : bottom;
+
+	for (uint8_t i = (index + 1) % ST7565R_DISPLAY_LIST_SIZE; i != end; i = (i + 1) % ST7565R_DISPLAY_LIST_SIZE)
+	{
+		const ST7565R_Command* cover = &displayList[i];
+		if (cover->type != COMMAND_BITMAP && cover->type != COMMAND_RECTANGLE && cover->type != COMMAND_ASSET) {continue;}
+		if (cover->left <= command->left && cover->right >= command->right &&
+			cover->top <= commandTop && cover->bottom >= commandBottom)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+#endif
+
+static void ST7565R_addRectangleToCurScreen(ST7565R_DrawState drawOrErase, int x1, int y1, int x2, int y2){
+	// Fill or erase a box of curScreen. Takes screen coordinates that have already been trimmed to the clip
+	ST7565R_markDirtyRegion(x1, y1, x2, y2);
+#ifdef ST7565R_PORTRAIT
+	ST7565R_physicalBox(&x1, &y1, &x2, &y2);		// A box turned is still a box
+#endif
+	for (int page = y1 / 8; page <= (y2 - 1) / 8; page++)
+	{	// Fill a page at a time with a mask of the rows it covers
+		int rowTop 		= (page * 8 > y1) ? page * 8 : y1;
+		int rowBottom 	= (page * 8 + 8 < y2) ? page * 8 + 8 : y2;
+		uint8_t mask 	= (uint8_t)((0xFF << (rowTop % 8)) & (0xFF >> (8 - (rowBottom - page * 8))));
+		uint8_t* dest 	= ST7565R_targetPage(page);
+
+		for (int column = x1; column < x2; column++)
+		{
+			if (drawOrErase == ERASE)	{dest[column] &= ~mask;}
+			else						{dest[column] |= mask;}
+		}
+	}
+}
+
+static void ST7565R_paintCircleShape(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius, ST7565R_CircleShape shape, int startAngle, int endAngle){
+	// What paintCircle(), paintFilledCircle() and paintArc() share. Angles are already 0 - 359 and end at or after the start
+	int cx 		= x + renderClip->originX;
+	int cy 		= y + renderClip->originY;
+	int r 		= (int)radius;
+	int x1 		= (cx - r < renderClip->left) ? renderClip->left : cx - r;
+	int y1 		= (cy - r < renderClip->top) ? renderClip->top : cy - r;
+	int x2 		= (cx + r + 1 > renderClip->right) ? renderClip->right : cx + r + 1;
+	int y2 		= (cy + r + 1 > renderClip->bottom) ? renderClip->bottom : cy + r + 1;
+	if (x1 >= x2 || y1 >= y2) {return;}
+#ifdef ST7565R_DISPLAY_LIST
+	ST7565R_Command command = {
+		.type = COMMAND_CIRCLE, .param = {drawOrErase, shape}, .x = cx, .y = cy, .width = radius, .data.point = {startAngle, endAngle}
+	};
+	if (ST7565R_listBounds(&command, x1, y1, x2 - x1, y2 - y1)) {ST7565R_listPush(&command);}
+	return;
+#endif
+
+	ST7565R_addCircleToCurScreen(drawOrErase, cx, cy, radius, shape, startAngle, endAngle);
+#ifdef PAINT_IMMEDIATELY
+	ST7565R_paintRegion(x1, y1, x2 - x1, y2 - y1);
+#endif
+}
+
+static void ST7565R_addCircleToCurScreen(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius, ST7565R_CircleShape shape, int startAngle, int endAngle){
+	// Circle centred on (x,y) in screen coordinates, clipped here. Fills go through the scanline filler, outlines and arcs
+	// are walked one octant with the midpoint algorithm (adds and compares only) and mirrored into the other seven
+	if (shape == CIRCLE_FILLED)
+	{
+		ST7565R_Shape circle = {.points = NULL, .x = x, .y = y, .radius = radius};
+		ST7565R_fillSpans(drawOrErase, &circle, y - (int)radius, y + (int)radius + 1);
+		return;
+	}
+
+	// An arc keeps the points clockwise of its start and anticlockwise of its end, tested with cross products.
+	// Past half a turn that region isn't convex, so it's everything outside the arc that's left out instead.
+	// Up to half a turn the points also have to be on the arc's side of the centre (a dot product with the
+	// direction halfway along it), or a zero sweep would keep both ends of the line through its start
+	int32_t startX 	= ST7565R_sine(startAngle + 90);
+	int32_t startY 	= ST7565R_sine(startAngle);
+	int32_t endX 	= ST7565R_sine(endAngle + 90);
+	int32_t endY 	= ST7565R_sine(endAngle);
+	bool wide 		= (endAngle - startAngle) > 180;
+
+	int left 	= renderClip->right;					// Box around what actually got plotted
+	int top 	= renderClip->bottom;
+	int right 	= renderClip->left;
+	int bottom 	= renderClip->top;
+	int dx 		= (int)radius;
+	int dy 		= 0;
+	int error 	= 1 - (int)radius;
+	while (dx >= dy)
+	{
+		const int8_t signs[8][3] = {{1, 1, 0}, {1, 1, 1}, {-1, 1, 1}, {-1, 1, 0}, {-1, -1, 0}, {-1, -1, 1}, {1, -1, 1}, {1, -1, 0}};
+		for (int i = 0; i < 8; i++)
+		{	// Each octant: a sign for x, a sign for y and whether x and y swap
+			int32_t px = signs[i][0] * (signs[i][2] ? dy : dx);
+			int32_t py = signs[i][1] * (signs[i][2] ? dx : dy);
+			int column = x + px;
+			int row 	= y + py;
+			if (column < renderClip->left || column >= renderClip->right || row < renderClip->top || row >= renderClip->bottom) {continue;}
+			if (shape == CIRCLE_ARC)
+			{
+				bool afterStart = (startX * py) - (startY * px) >= 0;
+				bool beforeEnd 	= (px * endY) - (py * endX) >= 0;
+				bool arcSide 	= (px * (startX + endX)) + (py * (startY + endY)) >= 0;
+				if (wide ? (!afterStart && !beforeEnd) : !(afterStart && beforeEnd && arcSide)) {continue;}
+			}
+			ST7565R_addPixelToCurScreen(drawOrErase, column, row);
+			if (column < left) 		{left = column;}
+			if (column >= right) 	{right = column + 1;}
+			if (row < top) 			{top = row;}
+			if (row >= bottom) 		{bottom = row + 1;}
+		}
+		dy++;
+		if (error < 0)
+		{
+			error += (2 * dy) + 1;
+		}
+		else
+		{
+			dx--;
+			error += (2 * (dy - dx)) + 1;
+		}
+	}
+	if (left < right) {ST7565R_markDirtyRegion(left, top, right, bottom);}
+}
+
+static void ST7565R_addPolygonToCurScreen(ST7565R_DrawState drawOrErase, const int16_t* points, unsigned count, int x, int y){
+	// Filled convex polygon, (x,y) is added to every point to put it in screen coordinates. Clipped here
+	ST7565R_Shape polygon = {.points = points, .count = count, .x = x, .y = y};
+	int x1, y1, x2, y2;
+	ST7565R_polygonBounds(points, count, &x1, &y1, &x2, &y2);
+	ST7565R_fillSpans(drawOrErase, &polygon, y1 + y, y2 + y);
+}
+
+static void ST7565R_polygonBounds(const int16_t* points, unsigned count, int* x1, int* y1, int* x2, int* y2){
+	// Box around the points, in their own coordinates, x2 and y2 just past it
+	*x1 = *x2 = points[0];
+	*y1 = *y2 = points[1];
+	for (unsigned i = 1; i < count; i++)
+	{
+		if (points[2 * i] < *x1) 		{*x1 = points[2 * i];}
+		if (points[2 * i] > *x2) 		{*x2 = points[2 * i];}
+		if (points[2 * i + 1] < *y1) 	{*y1 = points[2 * i + 1];}
+		if (points[2 * i + 1] > *y2) 	{*y2 = points[2 * i + 1];}
+	}
+	(*x2)++;
+	(*y2)++;
+}
+
+static void ST7565R_fillSpans(ST7565R_DrawState drawOrErase, const ST7565R_Shape* shape, int top, int bottom){
+	// Scanline filler: rows top to bottom of the shape, trimmed to the clip, a page at a time. Each row's span is found once,
+	// then every column of the page gets one mask of the rows it's inside and is ORed (or cleared) as a whole byte.
+	// Only the box around what was filled gets marked dirty
+	if (top < renderClip->top) 			{top = renderClip->top;}
+	if (bottom > renderClip->bottom) 	{bottom = renderClip->bottom;}
+	int boxLeft 	= renderClip->right;
+	int boxTop 		= bottom;
+	int boxRight 	= renderClip->left;
+	int boxBottom 	= top;
+
+	for (int page = top / 8; top < bottom && page <= (bottom - 1) / 8; page++)
+	{
+		int left[8];								// Each row's span, empty when left is past right
+		int right[8];
+		int first 	= renderClip->right;
+		int last 	= renderClip->left - 1;
+		for (int r = 0; r < 8; r++)
+		{
+			int row = (page * 8) + r;
+			left[r] 	= 0;
+			right[r] 	= -1;
+			if (row < top || row >= bottom || !ST7565R_shapeSpan(shape, row, &left[r], &right[r])) {continue;}
+			if (left[r] < renderClip->left) 		{left[r] = renderClip->left;}
+			if (right[r] >= renderClip->right) 	{right[r] = renderClip->right - 1;}
+			if (left[r] > right[r]) {continue;}
+			if (left[r] < first) 	{first = left[r];}
+			if (right[r] > last) 	{last = right[r];}
+			if (row < boxTop) 		{boxTop = row;}
+			if (row >= boxBottom) 	{boxBottom = row + 1;}
+		}
+
+		for (int block = first; block <= last; block += 8)
+		{	// 8 columns at a time, the size of the portrait transpose
+			uint8_t masks[8] = {0};
+			for (int c = 0; c < 8 && block + c <= last; c++)
+			{
+				for (int r = 0; r < 8; r++)
+				{
+					if (left[r] <= block + c && block + c <= right[r]) {masks[c] |= (uint8_t)(0b00000001 << r);}
+				}
+			}
+#ifdef ST7565R_PORTRAIT
+			uint8_t none[8] = {0};
+			ST7565R_blendBlockRotated(block, page * 8, (drawOrErase == ERASE) ? none : masks, masks);
+#else
+			uint8_t* dest = &ST7565R_targetPage(page)[block];
+			for (int c = 0; c < 8 && block + c <= last; c++)
+			{
+				if (drawOrErase == ERASE)	{dest[c] &= ~masks[c];}
+				else						{dest[c] |= masks[c];}
+			}
+#endif
+		}
+		if (first < boxLeft) 	{boxLeft = first;}
+		if (last >= boxRight) 	{boxRight = last + 1;}
+	}
+	if (boxLeft < boxRight) {ST7565R_markDirtyRegion(boxLeft, boxTop, boxRight, boxBottom);}
+}
+
+static bool ST7565R_shapeSpan(const ST7565R_Shape* shape, int row, int* left, int* right){
+	// First and last column of a shape on a row, false when the row misses it
+	if (shape->points == NULL)
+	{	// Circle: columns within radius + 1/2 of the centre, the same footprint the midpoint outline draws
+		int dy 	= row - shape->y;
+		int r 	= shape->radius;
+		if (dy < -r || dy > r) {return false;}
+		int half = (int)ST7565R_squareRoot((uint32_t)((r * r) + r - (dy * dy)));
+		*left 	= shape->x - half;
+		*right 	= shape->x + half;
+		return true;
+	}
+
+	// Convex polygon: the row crosses the edges at its two ends, so take the outermost crossings
+	bool found = false;
+	for (unsigned i = 0; i < shape->count; i++)
+	{
+		unsigned next 	= (i + 1 < shape->count) ? i + 1 : 0;
+		int x0 			= shape->x + shape->points[2 * i];
+		int y0 			= shape->y + shape->points[2 * i + 1];
+		int x1 			= shape->x + shape->points[2 * next];
+		int y1 			= shape->y + shape->points[2 * next + 1];
+		if ((row < y0 && row < y1) || (row > y0 && row > y1)) {continue;}
+
+		int from 	= x0;
+		int to 		= x1;
+		if (y0 != y1)
+		{	// Nearest column to where the edge crosses the middle of the row
+			from = to = x0 + ST7565R_roundedDivide((int32_t)(row - y0) * (x1 - x0), y1 - y0);
+		}
+		if (from > to) {int swap = from; from = to; to = swap;}
+		if (!found || from < *left) 	{*left = from;}
+		if (!found || to > *right) 		{*right = to;}
+		found = true;
+	}
+	return found;
+}
+
+static int ST7565R_sine(int degrees){
+	// sin() * 16384 of a whole number of degrees, from a quarter wave table
+	degrees = ((degrees % 360) + 360) % 360;
+	if (degrees <= 90) 	{return sineTable[degrees];}
+	if (degrees <= 180) {return sineTable[180 - degrees];}
+	if (degrees <= 270) {return -sineTable[degrees - 180];}
+	return -sineTable[360 - degrees];
+}
+
+static unsigned ST7565R_squareRoot(uint32_t value){
+	// Integer square root rounded down, a bit at a time without multiplying
+	uint32_t root 	= 0;
+	uint32_t bit 	= (uint32_t)1 << 30;
+	while (bit > value) {bit >>= 2;}
+	while (bit != 0)
+	{
+		if (value >= root + bit)
+		{
+			value 	-= root + bit;
+			root 	= (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+static int ST7565R_roundedDivide(int32_t numerator, int32_t denominator){
+	// numerator / denominator to the nearest whole number, halves rounded up, for either sign
+	if (denominator < 0)
+	{
+		numerator 	= -numerator;
+		denominator = -denominator;
+	}
+	numerator = (2 * numerator) + denominator;
+	denominator *= 2;
+	int32_t quotient = numerator / denominator;
+	if (numerator % denominator != 0 && numerator < 0) {quotient--;}		// C rounds towards 0, this wants down
+	return quotient;
+}
+
+static unsigned ST7565R_formatNumber(uint8_t* chars, int32_t value, uint8_t decimals, int8_t width, char pad){
+	// Turn a number into digit strip indices and return how many there are. Digits are found by
+	// subtracting powers of ten, which is far cheaper than dividing on parts without a divider.
+	uint8_t digits[10];
+	unsigned numDigits 	= 0;
+	uint32_t magnitude 	= (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+	if (decimals > 9) {decimals = 9;}
+
+	for (unsigned power = 0; power < 10; power++)
+	{	// Leading zeros are dropped, except the ones needed to show every decimal and a 0 before the point
+		uint8_t digit = 0;
+		while (magnitude >= powersOf10[power])
+		{
+			magnitude -= powersOf10[power];
+			digit++;
+		}
+		if (digit != 0 || numDigits != 0 || power >= 9u - decimals) {digits[numDigits++] = digit;}
+	}
+
+	unsigned length 	= numDigits + (decimals != 0) + (value < 0);
+	int padding 		= ((width < 0) ? -width : width) - (int)length;
+	if (padding < 0) 										{padding = 0;}
+	if (length + padding > ST7565R_NUMBER_MAX_CHARS) 		{padding = ST7565R_NUMBER_MAX_CHARS - length;}
+	unsigned count 		= 0;
+
+	if (width > 0 && pad != '0')
+	{	// Spaces go in front of the sign
+		while (padding > 0) {chars[count++] = ST7565R_NUMBER_SPACE; padding--;}
+	}
+	if (value < 0) {chars[count++] = ST7565R_NUMBER_MINUS;}
+	if (width > 0)
+	{	// Zeros go between the sign and the digits
+		while (padding > 0) {chars[count++] = 0; padding--;}
+	}
+	for (unsigned i = 0; i < numDigits; i++)
+	{
+		if (decimals != 0 && i == numDigits - decimals) {chars[count++] = ST7565R_NUMBER_POINT;}
+		chars[count++] = digits[i];
+	}
+	while (padding > 0)
+	{	// Left justified, pad the right with spaces
+		chars[count++] = ST7565R_NUMBER_SPACE;
+		padding--;
+	}
+	return count;
+}
+
+static void ST7565R_buildDigitStrip(void){
+	// Paint numberChars of renderFont into digitStrip: one cell of digitStripWidth columns by the font's
+	// pages per character, vertically oriented like a bitmap. Proportional glyphs are centred in their cell.
+	unsigned numChars 	= sizeof(numberChars) - 1;
+	unsigned pages 		= ST7565R_num_pages_from_height(renderFont->height);
+	unsigned width 		= ST7565R_digitWidth(renderFont);
+
+	digitStripFont 	= ST7565R_fontIdentity(renderFont);
+	digitStripWidth = width;
+	digitStripFits 	= (numChars * width * pages) <= ST7565R_DIGIT_STRIP_BYTES;
+	if (!digitStripFits) {return;}
+	memset(digitStrip, 0x00, numChars * width * pages);
+
+	for (unsigned i = 0; i < numChars; i++)
+	{
+		unsigned glyph 	= ST7565R_glyphIndex(renderFont, (uint8_t)numberChars[i]);
+		uint8_t* cell 	= &digitStrip[i * width * pages];
+		if (renderFont->glyphTable != NULL)
+		{	// Already vertical, copy it column by column into the middle of the cell
+			const ST7565R_Glyph* entry = &renderFont->glyphTable[glyph];
+			const uint8_t* glyphData = ST7565R_glyphData(glyph);
+			unsigned offset = (width - entry->width) / 2;
+			for (unsigned page = 0; page < pages && glyphData != NULL; page++)
+			{
+				memcpy(&cell[(page * width) + offset], &glyphData[page * entry->width], entry->width);
+			}
+			continue;
+		}
+
+		unsigned bytesPerRow 	= font_num_bytes_per_row(renderFont->width);
+		const uint8_t* charData = ST7565R_glyphData(glyph);
+		if (charData == NULL) {continue;}
+		for (unsigned row = 0; row < renderFont->height; row++)
+		{	// Horizontal font, turn each row into one bit of every column
+			const uint8_t* rowData 	= &charData[row * bytesPerRow];
+			uint8_t* dest 			= &cell[(row / 8) * width];
+			for (unsigned column = 0; column < width; column++)
+			{
+				if (rowData[column / 8] & (0b10000000 >> (column % 8))) {dest[column] |= (0b00000001 << (row % 8));}
+			}
+		}
+	}
+}
+
+static unsigned ST7565R_digitWidth(const ST7565R_Font* font){
+	// Columns per number character in a font. Proportional digits get the widest digit's advance, so numbers don't jiggle as they change
+	if (font->glyphTable == NULL) {return font->width;}
+	unsigned width = 0;
+	for (char c = '0'; c <= '9'; c++)
+	{
+		unsigned advance = ST7565R_codepointAdvance(font, c);
+		if (advance > width) {width = advance;}
+	}
+	return width;
+}
+
+static void ST7565R_addNumberCharToCurScreen(uint8_t index, int x, int y){
+	// Paint one cell of a number (opaque, so whatever was under it is replaced)
+	if (digitStripFont != ST7565R_fontIdentity(renderFont))
+	{
+		ST7565R_buildDigitStrip();
+	}
+	if (digitStripFits)
+	{
+		unsigned pages = ST7565R_num_pages_from_height(renderFont->height);
+		ST7565R_addBitmapToCurScreen(&digitStrip[index * digitStripWidth * pages], x, y, digitStripWidth, renderFont->height);
+		return;
+	}
+
+	// Font too big for the strip, erase the cell and paint the glyph
+	int x1 = (x < renderClip->left) ? renderClip->left : x;
+	int y1 = (y < renderClip->top) ? renderClip->top : y;
+	int x2 = (x + digitStripWidth > renderClip->right) ? renderClip->right : x + digitStripWidth;
+	int y2 = (y + renderFont->height > renderClip->bottom) ? renderClip->bottom : y + renderFont->height;
+	if (x1 >= x2 || y1 >= y2) {return;}
+	ST7565R_addRectangleToCurScreen(ERASE, x1, y1, x2, y2);
+	if (index != ST7565R_NUMBER_SPACE)
+	{
+		unsigned glyph = ST7565R_glyphIndex(renderFont, (uint8_t)numberChars[index]);
+		unsigned glyphWidth = (renderFont->glyphTable != NULL) ? renderFont->glyphTable[glyph].width : renderFont->width;
+		ST7565R_addGlyphToCurScreen(glyph, x + ((int)digitStripWidth - (int)glyphWidth) / 2, y);
+	}
+}
+
+static void ST7565R_forgetNumbers(int x1, int y1, int x2, int y2){
+	// Something is being drawn over this box, so numbers painted there can't be updated digit by digit anymore
+	for (int i = 0; i < ST7565R_NUMBER_CACHE_SIZE; i++)
+	{
+		ST7565R_NumberCache* entry = &numberCache[i];
+		if (entry->length == 0 || entry == numberBeingPainted) {continue;}
+		if (x2 <= entry->x || x1 >= entry->x + (entry->length * entry->charWidth)) 	{continue;}
+		if (y2 <= entry->y || y1 >= entry->y + entry->height) 						{continue;}
+		entry->length = 0;
+	}
+}
+
+static void ST7565R_paintGlyph(unsigned glyph, int x, int y, unsigned scale){
+	// Add a glyph to curScreen, scale times the size, and when painting immediately send the region it covers
+	ST7565R_addGlyphScaled(glyph, x, y, scale);
+#ifdef PAINT_IMMEDIATELY
+	unsigned width = (renderFont->glyphTable != NULL) ? renderFont->glyphTable[glyph].width : renderFont->width;
+	ST7565R_paintRegion(x, y, width * scale, renderFont->height * scale);
+#endif
+}
+
+static void ST7565R_addGlyphToCurScreen(unsigned glyph, int x, int y){
+	if (renderFont->glyphTable != NULL)
+	{	// Proportional fonts are vertically oriented, so the glyph is just a small bitmap
+		const uint8_t* glyphData = ST7565R_glyphData(glyph);
+		if (glyphData != NULL) {ST7565R_addBitmapToCurScreen(glyphData, x, y, renderFont->glyphTable[glyph].width, renderFont->height);}
+		return;
+	}
+
+	// Fixed width fonts are horizontal, trim the glyph's box to the clip once and then copy its bits
+	int x2 = x + renderFont->width;
+	int y2 = y + renderFont->height;
+	int startX = (x < renderClip->left) ? renderClip->left : x;
+	int startY = (y < renderClip->top) ? renderClip->top : y;
+	if (x2 > renderClip->right) 	{x2 = renderClip->right;}
+	if (y2 > renderClip->bottom) 	{y2 = renderClip->bottom;}
+
+	unsigned bytesPerRow 	= font_num_bytes_per_row(renderFont->width);
+	const uint8_t* charData = ST7565R_glyphData(glyph);
+	if (charData == NULL) {return;}
+#ifdef ST7565R_PORTRAIT
+	if (startX < x2 && startY < y2)
+	{
+		ST7565R_markDirtyRegion(startX, startY, x2, y2);
+		ST7565R_addGlyphRotated(charData, x, y, startX, startY, x2, y2);
+	}
+	return;
+#endif
+	for (int row = startY; row < y2; row++)
+	{
+		const uint8_t* rowData 	= &charData[(row - y) * bytesPerRow];
+		uint8_t* dest 			= ST7565R_targetPage(row / 8);
+		uint8_t bit 			= 0b00000001 << (row % 8);
+		for (int column = startX; column < x2; column++)
+		{
+			int glyphX = column - x;
+			if (rowData[glyphX / 8] & (0b10000000 >> (glyphX % 8)))	{dest[column] |= bit;}
+			else													{dest[column] &= ~bit;}
+		}
+	}
+	if (startX < x2 && startY < y2) {ST7565R_markDirtyRegion(startX, startY, x2, y2);}
+}
+
+static const uint8_t* ST7565R_glyphData(unsigned glyph){
+	// A glyph's bitmap in the current font, or fetched from its pack (good until the next fetch). NULL if it can't be read
+	unsigned bytesPerChar 	= font_num_bytes_per_char(renderFont->width, renderFont->height);
+	unsigned offset 		= (renderFont->glyphTable != NULL) ? renderFont->glyphTable[glyph].offset : glyph * bytesPerChar;
+#ifdef ST7565R_ASSET_PACK
+	if (renderFont->stream != NULL)
+	{
+		unsigned length = (renderFont->glyphTable != NULL) ? (unsigned)(renderFont->glyphTable[glyph].width * ST7565R_num_pages_from_height(renderFont->height)) : bytesPerChar;
+		return (length == 0) ? NULL : ST7565R_packFetch(renderFont->stream->pack, renderFont->stream->data + offset, length);
+	}
+#endif
+	return (renderFont->glyphs == NULL) ? NULL : &renderFont->glyphs[offset];
+}
+
+static const void* ST7565R_fontIdentity(const ST7565R_Font* font){
+	// What tells fonts apart for the number cache, digit strip and display list: their glyph data, or a streamed font's stream
+	return (font->glyphs != NULL) ? (const void*)font->glyphs : (const void*)font->stream;
+}
+
+static void ST7565R_addPixelToCurScreen(ST7565R_DrawState drawOrErase, unsigned x, unsigned y){
+	// Takes screen coordinates that have already been checked against the clip
+#if defined(ST7565R_ROTATE_90)
+	unsigned column = y;
+	y = SCREENHEIGHT - 1 - x;
+	x = column;
+#elif defined(ST7565R_ROTATE_270)
+	unsigned column = SCREENWIDTH - 1 - y;
+	y = x;
+	x = column;
+#endif
+
+	uint8_t* dest = &ST7565R_targetPage(y / 8)[x];
+	uint8_t newByte = *dest;
+	switch(drawOrErase)
+	{
+	case ERASE:
+		newByte &= ~(0b00000001 << (y % 8));
+		break;
+
+	case DRAW:
+	default:
+		newByte |= (0b00000001 << (y % 8));
+		break;
+	}
+	*dest = newByte;
+}
+
+static void ST7565R_addBitmapToCurScreen(const uint8_t* bitmap, int x, int y, unsigned width, unsigned height){
+	// Copy a vertically oriented bitmap into curScreen a whole byte at a time. Each destination byte is
+	// built from (at most) two source bytes shifted into place, so no per-pixel work is needed.
+	int x1 = x + (int)width;
+	int y1 = y + (int)height;
+	int startX = (x < renderClip->left) ? renderClip->left : x;
+	int startY = (y < renderClip->top) ? renderClip->top : y;
+	if (x1 > renderClip->right)	{x1 = renderClip->right;}
+	if (y1 > renderClip->bottom)	{y1 = renderClip->bottom;}
+	if (startX >= x1 || startY >= y1) {return;}
+	ST7565R_markDirtyRegion(startX, startY, x1, y1);
+#ifdef ST7565R_PORTRAIT
+	ST7565R_addBitmapRotated(bitmap, x, y, width, startX, startY, x1, y1);
+	return;
+#endif
+
+	int srcPages = ST7565R_num_pages_from_height(height);
+	for (int page = startY / 8; page <= (y1 - 1) / 8; page++)
+	{	// Rows of this page covered by the bitmap
+		int rowTop 		= (page * 8 > startY) ? page * 8 : startY;
+		int rowBottom 	= (page * 8 + 8 < y1) ? page * 8 + 8 : y1;
+		uint8_t mask 	= (uint8_t)((0xFF << (rowTop % 8)) & (0xFF >> (8 - (rowBottom - page * 8))));
+
+		int srcRow 		= (page * 8) - y;					// Bitmap row that lands on bit 0 of this page (-7 to height)
+		int srcPage 	= ((srcRow + 8) / 8) - 1;			// Floor division, srcRow is never below -7
+		int shift 		= srcRow - (srcPage * 8);
+		uint8_t* dest 	= &ST7565R_targetPage(page)[startX];
+		const uint8_t* upper = (srcPage >= 0 && srcPage < srcPages) 		? &bitmap[(width * srcPage) + (startX - x)] 		: NULL;
+		const uint8_t* lower = (srcPage + 1 < srcPages && shift != 0) 	? &bitmap[(width * (srcPage + 1)) + (startX - x)] 	: NULL;
+
+		for (int i = 0; i < x1 - startX; i++)
+		{
+			uint8_t bits = 0;
+			if (upper != NULL) {bits  = upper[i] >> shift;}
+			if (lower != NULL) {bits |= lower[i] << (8 - shift);}
+			dest[i] = (dest[i] & ~mask) | (bits & mask);
+		}
+	}
 }
 
-void ST7565R_paintPixel(ST7565R_DrawState drawOrErase, unsigned x, unsigned y)
-{	// Paint an individual pixel at a specified (x,y) coordinate.  DON'T FORGET TO updateDisplay()
-	if (x >= SCREENWIDTH) {return;}
-	if (y >= SCREENHEIGHT){return;}
-	int byteIndex = (SCREENWIDTH * (y / 8)) + x;
-	uint8_t colMSB = x / 0x10;
-	uint8_t colLSB = x % 0x10;
+static void ST7565R_addGlyphScaled(unsigned glyph, int x, int y, unsigned scale){
+	// addGlyphToCurScreen() scale times the size. Fixed width glyphs are horizontal, so each 8x8 block of one is first turned
+	// into 8 column bytes, then everything goes through addPageScaled()
+	if (scale <= 1)
+	{
+		ST7565R_addGlyphToCurScreen(glyph, x, y);
+		return;
+	}
+	if (renderFont->glyphTable != NULL)
+	{
+		const uint8_t* glyphData = ST7565R_glyphData(glyph);
+		if (glyphData != NULL) {ST7565R_addBitmapScaled(glyphData, x, y, renderFont->glyphTable[glyph].width, renderFont->height, scale);}
+		return;
+	}
 
-	ST7565R_addPixelToCurScreen(drawOrErase, x, y);
-	ST7565R_command(ST7565R_CMD_DISPLAY_OFF);		    // Set Display OFF
-	ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(y/8)); // Specify which page to draw to
-	ST7565R_command(ST7565R_CMD_COLUMN_MSB(colMSB));	// Specify which column to draw to, upper 4 bits + 0x10
-	ST7565R_command(ST7565R_CMD_COLUMN_LSB(colLSB));	// Specify which column to draw to, lower 4 bits + 0x00
-	ST7565R_paintByteHere(curScreen[byteIndex]);						// Paint the new byte with the new pixel
-	ST7565R_command(ST7565R_CMD_DISPLAY_ON);			// Set Display ON
+	unsigned bytesPerRow 	= font_num_bytes_per_row(renderFont->width);
+	const uint8_t* charData = ST7565R_glyphData(glyph);
+	if (charData == NULL) {return;}
+	for (unsigned top = 0; top < renderFont->height; top += 8)
+	{
+		unsigned rows = (renderFont->height - top < 8) ? renderFont->height - top : 8;
+		for (unsigned i = 0; i < bytesPerRow; i++)
+		{
+			uint8_t in[8];
+			uint8_t out[8];
+			uint8_t columns[8];
+			for (unsigned r = 0; r < 8; r++) {in[r] = (r < rows) ? charData[((top + r) * bytesPerRow) + i] : 0;}
+			ST7565R_transpose8(in, out);
+			for (unsigned c = 0; c < 8; c++) {columns[c] = out[7 - c];}		// A row byte's MSB is its leftmost column
+			unsigned count = (renderFont->width - (i * 8) < 8) ? renderFont->width - (i * 8) : 8;
+			ST7565R_addPageScaled(columns, count, rows, x + (int)(i * 8 * scale), y + (int)(top * scale), scale);
+		}
+	}
 }
 
-void ST7565R_paintString(char* string, unsigned x, unsigned y)
-{	// Paint a string of characters at a specified (x,y) coordinate. DON'T FORGET TO updateDisplay()
-	if (string == NULL)	 	{return;}
-	if (x >= SCREENWIDTH) 	{return;}
-	if (y >= SCREENHEIGHT)	{return;}
-	unsigned originalX = x;
-
-	for (int i = 0; i < strlen(string); i++)
+static void ST7565R_addBitmapScaled(const uint8_t* bitmap, int x, int y, unsigned width, unsigned height, unsigned scale){
+	// addBitmapToCurScreen() scale times the size, a page of the bitmap at a time
+	if (scale <= 1)
 	{
+		ST7565R_addBitmapToCurScreen(bitmap, x, y, width, height);
+		return;
+	}
+	for (unsigned page = 0; page * 8 < height; page++)
+	{
+		unsigned rows = (height - (page * 8) < 8) ? height - (page * 8) : 8;
+		ST7565R_addPageScaled(&bitmap[width * page], width, rows, x, y + (int)(page * 8 * scale), scale);
+	}
+}
 
-		// Special Characters
-		switch (string[i])
+static void ST7565R_addPageScaled(const uint8_t* columns, unsigned count, unsigned rows, int x, int y, unsigned scale){
+	// count column bytes of one page (the top rows bits of each), scale times the size with the top left at (x,y). Each byte
+	// is spread through bitSpread into the scale bytes of a scaled column, which repeats scale times across. They're built
+	// into a buffer a few columns wide and painted like any bitmap, so it's whole bytes all the way down
+	if (y >= renderClip->bottom || y + (int)(rows * scale) <= renderClip->top) {return;}
+	uint8_t chunk[ST7565R_SCALE_MAX * ST7565R_SCALE_CHUNK];
+	const uint16_t* spread 	= bitSpread[scale - 2];
+	unsigned perChunk 		= ST7565R_SCALE_CHUNK / scale;					// Source columns in each chunk
+	for (unsigned first = 0; first < count; first += perChunk)
+	{
+		unsigned num 	= (count - first < perChunk) ? count - first : perChunk;
+		unsigned width 	= num * scale;
+		int left 		= x + (int)(first * scale);
+		if (left >= renderClip->right) 				{break;}
+		if (left + (int)width <= renderClip->left) 	{continue;}
+		for (unsigned i = 0; i < num; i++)
 		{
-		case '\n': // New Line
-			y += curFont.height + 1;
-			continue;
-		case '\r': // Carriage Return
-			x = originalX;
-			continue;
-		case '\t': // Tab
-			x += 2 * curFont.width;
-			continue;
-		case '\0': // End of String
-			continue;
+			uint8_t bits 	= columns[first + i];
+			uint32_t column = spread[bits & 0x0F] | ((uint32_t)spread[bits >> 4] << (4 * scale));
+			for (unsigned page = 0; page < scale; page++)
+			{
+				memset(&chunk[(width * page) + (i * scale)], (uint8_t)(column >> (8 * page)), scale);
+			}
 		}
+		ST7565R_addBitmapToCurScreen(chunk, left, y, width, rows * scale);
+	}
+}
 
-#ifdef PAINT_IMMEDIATELY
-		ST7565R_paintChar(string[i], x, y);
-#else
-		ST7565R_addCharToCurScreen(string[i], x, y);
-#endif
-		x += curFont.width;
+static void ST7565R_transpose8(const uint8_t* in, uint8_t* out){
+	// Turn 8 bytes of 8 bits on their side: bit c of out[r] is bit r of in[c]. Swaps 1x1, then 2x2, then 4x4 blocks across
+	// the diagonal with shifts and masks (Hacker's Delight 7-3), a few dozen instructions for 64 pixels
+	uint32_t x = in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+	uint32_t y = in[4] | ((uint32_t)in[5] << 8) | ((uint32_t)in[6] << 16) | ((uint32_t)in[7] << 24);
+	uint32_t t;
+	t = (x ^ (x >> 7)) & 0x00AA00AA;	x ^= t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AA;	y ^= t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC;	x ^= t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCC;	y ^= t ^ (t << 14);
+	t = (x & 0x0F0F0F0F) | ((y << 4) & 0xF0F0F0F0);
+	y = ((x >> 4) & 0x0F0F0F0F) | (y & 0xF0F0F0F0);
+	x = t;
+	for (int i = 0; i < 4; i++)
+	{
+		out[i] 		= (uint8_t)(x >> (8 * i));
+		out[i + 4] 	= (uint8_t)(y >> (8 * i));
 	}
 }
 
-void ST7565R_paintChar(char c, unsigned x, unsigned y)
-{	// Paint an individual character at a specified (x,y) coordinate
-	unsigned originalX 			= x;
-	unsigned bytesPerRow 		= font_num_bytes_per_row(curFont.width);
-	unsigned bytesPerChar 		= font_num_bytes_per_char(curFont.width, curFont.height);
-	unsigned startIndex 		= (c - curFont.firstChar) * bytesPerChar;
-	unsigned endIndex 			= startIndex + bytesPerChar;
-	unsigned iterateRowTest 	= 0;
-	unsigned width 				= 0;
-
-
-	for (int i = startIndex; i < endIndex; i++)
-	{	// Loop for all the bytes
-		uint8_t charByte = curFont.glyphs[i];
-		for (int j = 0; j < 8; j++)
-		{	//Loop for each individual bit
-			width = x - originalX;
-			if (width < curFont.width)
+static void ST7565R_addAssetToCurScreen(const ST7565R_Asset* asset, unsigned frame, int x, int y){
+	// Unpack one frame of an asset into curScreen. Raw frames are just a bitmap. Packed frames are unpacked a few columns of
+	// a page at a time into a small buffer and painted from there, so nothing the size of the asset is ever needed
+	const uint8_t* src = &asset->data[asset->frameOffsets[frame]];
+	if (asset->encoding == ASSET_RAW)
+	{
+		ST7565R_addBitmapToCurScreen(src, x, y, asset->width, asset->height);
+		return;
+	}
+
+	uint8_t chunk[ST7565R_ASSET_CHUNK];
+	uint8_t run 		= 0;					// RLE: repeats of value, or literal bytes, still to come. Runs carry on across pages
+	uint8_t literal 	= 0;
+	uint8_t value 		= 0;
+	unsigned across 	= (asset->width + 7) / 8;
+	int pages 			= ST7565R_num_pages_from_height(asset->height);
+	for (int page = 0; page < pages; page++)
+	{
+		int pageY 		= y + (page * 8);
+		unsigned rows 	= (asset->height - (page * 8) < 8) ? asset->height - (page * 8) : 8;
+		bool rowsShown 	= pageY < renderClip->bottom && pageY + (int)rows > renderClip->top;
+		if (!rowsShown && asset->encoding == ASSET_TILED) {continue;}	// RLE has to be read in order, tiles don't
+
+		for (unsigned column = 0; column < asset->width; column += ST7565R_ASSET_CHUNK)
+		{
+			unsigned count = (asset->width - column < ST7565R_ASSET_CHUNK) ? asset->width - column : ST7565R_ASSET_CHUNK;
+			bool shown = rowsShown && x + (int)column < renderClip->right && x + (int)(column + count) > renderClip->left;
+			if (asset->encoding == ASSET_TILED)
 			{
-				bool drawOrErase = (0b10000000 & (charByte << j)) != 0;
-#ifdef PAINT_IMMEDIATELY
-				ST7565R_paintPixel(drawOrErase, x, y);
-#else
-				ST7565R_addPixelToCurScreen(drawOrErase, x, y);
-#endif
+				if (!shown) {continue;}
+				for (unsigned i = 0; i < count; i++)
+				{
+					unsigned c = column + i;
+					chunk[i] = asset->tiles[(src[(page * across) + (c / 8)] * 8) + (c % 8)];
+				}
+			}
+			else
+			{
+				for (unsigned i = 0; i < count; i++)
+				{
+					if (run == 0 && literal == 0)
+					{
+						uint8_t control = *src++;
+						if (control & 0x80) {run = (control & 0x7F) + 1;	value = *src++;}
+						else 				{literal = control + 1;}
+					}
+					if (run != 0) 	{chunk[i] = value;		run--;}
+					else 			{chunk[i] = *src++;		literal--;}
+				}
+			}
+			if (shown)
+			{
+				ST7565R_addBitmapToCurScreen(chunk, x + (int)column, pageY, count, rows);
 			}
-			x++;
 		}
+	}
+}
 
-
-		iterateRowTest++;
-		if (iterateRowTest % bytesPerRow == 0)
-		{	// Test for Next Line/Row
-			x = originalX;
-			y++;
+#ifdef ST7565R_ASSET_PACK
+static const uint8_t* ST7565R_packFetch(const ST7565R_Pack* pack, uint32_t offset, unsigned length){
+	// length bytes of a pack from offset: in place for a mapped pack, otherwise from a cached block, reading a block from offset
+	// into the least recently used slot when none has them all. Good until the next fetch. NULL past the end, longer than a block or on a read error
+	if (pack == NULL || length > pack->size || offset > pack->size - length) {return NULL;}
+	if (pack->mapped != NULL) 					{return &pack->mapped[offset];}
+	if (length > ST7565R_PACK_CACHE_BYTES) 		{return NULL;}
+
+	packClock++;
+	ST7565R_PackSlot* oldest = &packCache[0];
+	for (int i = 0; i < ST7565R_PACK_CACHE_SLOTS; i++)
+	{
+		ST7565R_PackSlot* slot = &packCache[i];
+		if (slot->pack == pack && offset >= slot->offset && offset + length <= slot->offset + slot->length)
+		{
+			slot->used = packClock;
+			packStats.hits++;
+			return &slot->bytes[offset - slot->offset];
 		}
+		if (slot->used < oldest->used) {oldest = slot;}
 	}
+
+	// Read ahead as far as the block goes, strings and frames are mostly read in order
+	unsigned count = (pack->size - offset < ST7565R_PACK_CACHE_BYTES) ? pack->size - offset : ST7565R_PACK_CACHE_BYTES;
+	packStats.misses++;
+	oldest->pack = NULL;
+	oldest->used = 0;
+	if (!pack->read(offset, oldest->bytes, count, pack->context)) {return NULL;}
+	packStats.bytesRead += count;
+	oldest->pack 	= pack;
+	oldest->offset 	= offset;
+	oldest->length 	= count;
+	oldest->used 	= packClock;
+	return oldest->bytes;
 }
 
-void ST7565R_paintFullscreenBitmap(uint8_t* bitmap)
-{// Paint a bitmap that matches the size of the screen,  DON"T FORGET TO updateDisplay()
-	if (bitmap == NULL)
-	{	// Catch Null Pointers
-		bitmap = bmp_clear();
+static uint32_t ST7565R_packWord(const uint8_t* bytes){
+	// A little endian uint32_t of a pack
+	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static int ST7565R_packStreamByte(const ST7565R_Pack* pack, uint32_t* next, uint32_t end, const uint8_t** window, unsigned* left){
+	// The next byte of a run of a pack read in order, a block at a time. -1 at end or on a read error
+	if (*left == 0)
+	{
+		unsigned count = (end - *next < ST7565R_PACK_CACHE_BYTES) ? end - *next : ST7565R_PACK_CACHE_BYTES;
+		*window = (count == 0) ? NULL : ST7565R_packFetch(pack, *next, count);
+		if (*window == NULL) {return -1;}
+		*next += count;
+		*left = count;
 	}
+	(*left)--;
+	return *(*window)++;
+}
+
+static bool ST7565R_addPackFrame(const ST7565R_Pack* pack, const ST7565R_PackEntry* entry, unsigned frame, int x, int y){
+	// addAssetToCurScreen() fetching as it goes: raw columns and tiles only where they're shown, RLE a block at a time in order.
+	// Every fetch is used up before the next one. False if a read failed, whatever was painted before stays
+	const uint8_t* bytes = ST7565R_packFetch(pack, entry->table + (frame * 4), 4);
+	if (bytes == NULL) {return false;}
+	uint32_t start 		= entry->data + ST7565R_packWord(bytes);
+	uint32_t next 		= start;				// RLE: where the next block starts
+	uint32_t end 		= entry->data + entry->length;
+	const uint8_t* window = NULL;
+	unsigned left 		= 0;
+	if (start > end) {return false;}
+
+	uint8_t chunk[ST7565R_ASSET_CHUNK];
+	uint8_t run 		= 0;
+	uint8_t literal 	= 0;
+	uint8_t value 		= 0;
+	unsigned across 	= (entry->width + 7) / 8;
+	int pages 			= ST7565R_num_pages_from_height(entry->height);
+	for (int page = 0; page < pages; page++)
+	{
+		int pageY 		= y + (page * 8);
+		unsigned rows 	= (entry->height - (page * 8) < 8) ? entry->height - (page * 8) : 8;
+		bool rowsShown 	= pageY < renderClip->bottom && pageY + (int)rows > renderClip->top;
+		if (!rowsShown && entry->encoding != ASSET_RLE) {continue;}
 
-	for (int i = 0; i < SCREENBYTES; i++)
-	{	// Set the curScreen to the new bitmap
-		curScreen[i] = bitmap[i];
+		for (unsigned column = 0; column < entry->width; column += ST7565R_ASSET_CHUNK)
+		{
+			unsigned count = (entry->width - column < ST7565R_ASSET_CHUNK) ? entry->width - column : ST7565R_ASSET_CHUNK;
+			bool shown = rowsShown && x + (int)column < renderClip->right && x + (int)(column + count) > renderClip->left;
+			const uint8_t* columns = chunk;
+			if (entry->encoding == ASSET_RAW)
+			{
+				if (!shown) {continue;}
+				columns = ST7565R_packFetch(pack, start + (page * entry->width) + column, count);
+				if (columns == NULL) {return false;}
+			}
+			else if (entry->encoding == ASSET_TILED)
+			{
+				if (!shown) {continue;}
+				const uint8_t* tile = NULL;
+				for (unsigned i = 0; i < count; i++)
+				{
+					unsigned c = column + i;
+					if (tile == NULL || c % 8 == 0)
+					{	// The tile's index, then the tile
+						bytes = ST7565R_packFetch(pack, start + (page * across) + (c / 8), 1);
+						tile = (bytes == NULL) ? NULL : ST7565R_packFetch(pack, entry->tiles + (*bytes * 8), 8);
+						if (tile == NULL) {return false;}
+					}
+					chunk[i] = tile[c % 8];
+				}
+			}
+			else
+			{
+				for (unsigned i = 0; i < count; i++)
+				{
+					if (run == 0 && literal == 0)
+					{
+						int control = ST7565R_packStreamByte(pack, &next, end, &window, &left);
+						int repeated = (control & 0x80) ? ST7565R_packStreamByte(pack, &next, end, &window, &left) : 0;
+						if (control < 0 || repeated < 0) {return false;}
+						if (control & 0x80) {run = (control & 0x7F) + 1;	value = (uint8_t)repeated;}
+						else 				{literal = control + 1;}
+					}
+					if (run != 0) 	{chunk[i] = value;		run--;}
+					else
+					{
+						int byte = ST7565R_packStreamByte(pack, &next, end, &window, &left);
+						if (byte < 0) {return false;}
+						chunk[i] = (uint8_t)byte;
+						literal--;
+					}
+				}
+			}
+			if (shown)
+			{
+				ST7565R_addBitmapToCurScreen(columns, x + (int)column, pageY, count, rows);
+			}
+		}
 	}
-#ifdef PAINT_IMMEDIATELY
-	ST7565R_paintCurScreen();
-#endif
+	return true;
 }
+#endif
 
-void ST7565R_paintBitmap(uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height)
-{	// Paint a bitmap to a specified (x,y) coordinate of the screen
-	if (bitmap == NULL)	   	{return;}
-	if (x >= SCREENWIDTH)  	{return;}
-	if (y >= SCREENHEIGHT) 	{return;}
-
-	unsigned originalX 		= x;
-	unsigned x2 			= x + width;
-	unsigned y2 			= y + height;
-	unsigned pages 			= ST7565R_num_pages_from_height(height);
-
-	for (int i = x; i < x2; i++)
-	{	// Iterator for x coordinate on the screen
-		for (int j = y; j < y2; j++)
-		{	// Iterator for y coordinate on the screen
-			int bmpX = i - x; // The X coord in the provided bitmap
-			int bmpY = j - y; // The Y coord in the provided bitmap
-			int byteIndex = (width * (bmpY / 8)) + bmpX;
-			ST7565R_DrawState drawOrErase = (bitmap[byteIndex] & (0b00000001 << (bmpY % 8))) != 0;
-#ifdef PAINT_IMMEDIATELY
-			ST7565R_paintPixel(drawOrErase, i, j);
+#ifdef ST7565R_PORTRAIT
+static void ST7565R_physicalBox(int* x1, int* y1, int* x2, int* y2){
+	// Turn a box as the paint functions see it into the panel's columns (x) and rows (y)
+	int left = *x1, top = *y1, right = *x2, bottom = *y2;
+#ifdef ST7565R_ROTATE_90
+	*x1 = top;								// Down the portrait screen is along the panel
+	*x2 = bottom;
+	*y1 = SCREENHEIGHT - right;				// Across it is up the panel
+	*y2 = SCREENHEIGHT - left;
 #else
-			ST7565R_addPixelToCurScreen(drawOrErase, i, j);
+	*x1 = SCREENWIDTH - bottom;				// Down the portrait screen is back along the panel
+	*x2 = SCREENWIDTH - top;
+	*y1 = left;								// Across it is down the panel
+	*y2 = right;
 #endif
-		}
-	}
 }
 
-void ST7565R_paintRectangle(ST7565R_DrawState drawOrErase, unsigned x, unsigned y, unsigned width, unsigned height){
-	if (x >= SCREENWIDTH  || width > SCREENWIDTH) 	{return;}
-	if (y >= SCREENHEIGHT || height > SCREENHEIGHT)	{return;}
+#ifdef ST7565R_ROTATE_270
+static uint8_t ST7565R_reverseBits(uint8_t bits){
+	// Mirror a byte, MSB to LSB
+	bits = (uint8_t)(((bits & 0xF0) >> 4) | ((bits & 0x0F) << 4));
+	bits = (uint8_t)(((bits & 0xCC) >> 2) | ((bits & 0x33) << 2));
+	return (uint8_t)(((bits & 0xAA) >> 1) | ((bits & 0x55) << 1));
+}
+#endif
 
-	unsigned originalX 		= x;
-	unsigned x2 			= x + width;
-	unsigned y2 			= y + height;
+static void ST7565R_blendColumn(int column, int row, uint8_t bits, uint8_t mask){
+	// Put 8 vertical bits into a panel column, bit 0 at row (-7 and up), where mask is set. Lands in at most two pages
+	int page 	= ((row + 8) / 8) - 1;				// Floor division, row is never below -7
+	int shift 	= row - (page * 8);
+	if (page >= 0 && page < SCREENPAGES)
+	{
+		uint8_t* dest 	= &ST7565R_targetPage(page)[column];
+		uint8_t m 		= (uint8_t)(mask << shift);
+		*dest = (*dest & ~m) | ((uint8_t)(bits << shift) & m);
+	}
+	if (shift != 0 && page + 1 < SCREENPAGES)
+	{
+		uint8_t* dest 	= &ST7565R_targetPage(page + 1)[column];
+		uint8_t m 		= mask >> (8 - shift);
+		*dest = (*dest & ~m) | ((bits >> (8 - shift)) & m);
+	}
+}
 
-	for (int i = x; i < x2; i++)
+static void ST7565R_addGlyphRotated(const uint8_t* charData, int x, int y, int startX, int startY, int x2, int y2){
+	// Portrait fixed width glyph, already trimmed to startX - x2, startY - y2. A glyph row is a panel column, so each byte
+	// of a horizontal glyph row is already 8 vertical pixels: no transposing, just a shift into one or two pages.
+	// Turned 90 the row's MSB (left) ends up lowest on the panel, so the byte goes in as it is, turned 270 it's mirrored
+	unsigned bytesPerRow = font_num_bytes_per_row(renderFont->width);
+	for (int row = startY; row < y2; row++)
 	{
-		for (int j = y; j < y2; j++)
+		const uint8_t* rowData = &charData[(row - y) * bytesPerRow];
+		for (unsigned i = 0; i < bytesPerRow; i++)
 		{
-#ifdef PAINT_IMMEDIATELY
-			ST7565R_paintPixel(drawOrErase, i, j);
+			int left 	= x + (int)(i * 8);						// Column of this byte's MSB
+			int from 	= (startX > left) ? startX : left;
+			int to 		= (x2 < left + 8) ? x2 : left + 8;
+			if (from >= to) {continue;}
+			uint8_t mask = (uint8_t)((0xFF >> (from - left)) & (0xFF << (left + 8 - to)));
+#ifdef ST7565R_ROTATE_90
+			ST7565R_blendColumn(row, SCREENHEIGHT - 8 - left, rowData[i], mask);
 #else
-			ST7565R_addPixelToCurScreen(drawOrErase, i, j);
+			ST7565R_blendColumn(SCREENWIDTH - 1 - row, left, ST7565R_reverseBits(rowData[i]), ST7565R_reverseBits(mask));
 #endif
 		}
 	}
 }
 
-void ST7565R_clearScreen(void)
-{	// Erase the entire screen
-	ST7565R_paintFullscreenBitmap((uint8_t*)bmp_clear());
-	ST7565R_updateDisplay();
+static void ST7565R_addBitmapRotated(const uint8_t* bitmap, int x, int y, unsigned width, int startX, int startY, int x2, int y2){
+	// Portrait vertically oriented bitmap, already trimmed to startX - x2, startY - y2. Taken 8 columns by 1 page at a time
+	int firstBlock = ((startX - x) / 8) * 8;
+	for (int srcPage = (startY - y) / 8; srcPage <= (y2 - 1 - y) / 8; srcPage++)
+	{
+		const uint8_t* src 	= &bitmap[width * srcPage];
+		int top 			= y + (srcPage * 8);
+		int from 			= (startY > top) ? startY - top : 0;			// Rows of this page inside the trim
+		int to 				= (y2 < top + 8) ? y2 - top : 8;
+		uint8_t rows 		= (uint8_t)((0xFF << from) & (0xFF >> (8 - to)));
+		for (int block = firstBlock; x + block < x2; block += 8)
+		{
+			uint8_t bits[8];
+			uint8_t masks[8];
+			for (int c = 0; c < 8; c++)
+			{
+				int column 	= x + block + c;
+				bool shown 	= column >= startX && column < x2;
+				bits[c] 	= shown ? src[block + c] : 0;
+				masks[c] 	= shown ? rows : 0;
+			}
+			ST7565R_blendBlockRotated(x + block, top, bits, masks);
+		}
+	}
 }
 
-void ST7565R_updateDisplay(void){
-#ifndef PAINT_IMMEDIATELY
-	ST7565R_paintCurScreen();
-	for(int i = 0; i < SCREENBYTES; i++){
-		lastScreen[i] = curScreen[i];
-		curScreen[i] = 0x00;
-	} 	// Record the displayed screen and reset the current screen data-structure
+static void ST7565R_blendBlockRotated(int x, int y, const uint8_t* bits, const uint8_t* masks){
+	// Portrait block of 8 columns by 8 rows at (x,y), column c in bits[c] and masks[c] with the top row in bit 0. Only pixels
+	// whose mask bit is set are written. Transposed, the block's 8 bytes each become a panel column holding the 8 columns'
+	// bits for one row. Turned 90 the block's columns run up the panel, so they go in backwards
+	uint8_t in[8];
+	uint8_t inMask[8];
+	uint8_t out[8];
+	uint8_t outMask[8];
+	for (int c = 0; c < 8; c++)
+	{
+#ifdef ST7565R_ROTATE_90
+		in[7 - c] 		= bits[c];
+		inMask[7 - c] 	= masks[c];
+#else
+		in[c] 			= bits[c];
+		inMask[c] 		= masks[c];
+#endif
+	}
+	ST7565R_transpose8(in, out);
+	ST7565R_transpose8(inMask, outMask);
+	for (int r = 0; r < 8; r++)
+	{
+		if (outMask[r] == 0) {continue;}
+#ifdef ST7565R_ROTATE_90
+		ST7565R_blendColumn(y + r, SCREENHEIGHT - 8 - x, out[r], outMask[r]);
+#else
+		ST7565R_blendColumn(SCREENWIDTH - 1 - (y + r), x, out[r], outMask[r]);
 #endif
+	}
 }
+#endif
 
+#ifdef PAINT_IMMEDIATELY
+static void ST7565R_paintRegion(int x, int y, unsigned width, unsigned height){
+	// Send a rectangle of curScreen (trimmed to the clip) to the display, one page at a time. The column
+	// address auto-increments after each data byte, so each page only needs one set of address commands.
+	// Locked while it sends, so a scrub tick from a timer knows to keep off the wire
+	int x2 = x + (int)width;
+	int y2 = y + (int)height;
+	if (x < renderClip->left) 		{x = renderClip->left;}
+	if (y < renderClip->top) 		{y = renderClip->top;}
+	if (x2 > renderClip->right) 	{x2 = renderClip->right;}
+	if (y2 > renderClip->bottom) 	{y2 = renderClip->bottom;}
+	if (x >= x2 || y >= y2) {return;}
+#ifdef ST7565R_PORTRAIT
+	ST7565R_physicalBox(&x, &y, &x2, &y2);
+#endif
 
-/****************************************************
-*   FUNCTIONS NOT TO BE REFERENCED OUTSIDE DRIVER   *
-****************************************************/
-static void ST7565R_paintCurScreen(void){
-	uint8_t page 		= 0;
-	uint8_t column 		= 0;
-	uint8_t colMSB 		= column / 0x10;
-	uint8_t colLSB 		= column % 0x10;
-	int byteIndex		= (SCREENWIDTH * page) + column;
-
+	ST7565R_lock();
 	ST7565R_command(ST7565R_CMD_DISPLAY_OFF);
-	for (int i = 0; i < SCREENPAGES; i++)
-	{	// 32 pixel display / 8 pixels per page = 4 pages
+	for (int page = y / 8; page <= (y2 - 1) / 8; page++)
+	{
 		ST7565R_command(ST7565R_CMD_PAGE_ADDRESS_SET(page));
-
-		for (int j = 0; j < SCREENWIDTH; j++)
-		{	// 128 columns wide
-
-#ifndef PAINT_IMMEDIATELY
-			if (curScreen[byteIndex] == lastScreen[byteIndex])
-			{	// Only paint if there's something new
-				column++;
-				byteIndex++;
-				continue;
-			}
-#endif
-			colMSB = column / 0x10;
-			colLSB = column % 0x10;
-			ST7565R_command(ST7565R_CMD_COLUMN_MSB(colMSB));		// Specify which column to draw to, upper 4 bits + 0x10
-			ST7565R_command(ST7565R_CMD_COLUMN_LSB(colLSB));		// Specify which column to draw to, lower 4 bits + 0x00
-			ST7565R_paintByteHere(curScreen[byteIndex]);		// Send bitmap byte
-
-			column++;
-			byteIndex++;
-		}
-		page++;		// After drawing, go to next page
-		column = 0;
+		ST7565R_command(ST7565R_CMD_COLUMN_MSB(x / 0x10));
+		ST7565R_command(ST7565R_CMD_COLUMN_LSB(x % 0x10));
+		ST7565R_paintBytesHere(&curScreen[(SCREENWIDTH * page) + x], x2 - x);
 	}
-	ST7565R_command(ST7565R_CMD_DISPLAY_ON);			// Set Display ON
+	ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+	ST7565R_unlock();
 }
+#endif
 
-static void ST7565R_addCharToCurScreen(char c, unsigned x, unsigned y){
-	unsigned originalX 		= x;
-	unsigned bytesPerRow 	= font_num_bytes_per_row(curFont.width);
-	unsigned bytesPerChar 	= font_num_bytes_per_char(curFont.width, curFont.height);
-	unsigned startIndex 	= (c - curFont.firstChar) * bytesPerChar;
-	unsigned endIndex 		= startIndex + bytesPerChar;
-	unsigned iterateRowTest = 0;
-	unsigned width 			= 0;
-
-
-	for (int i = startIndex; i < endIndex; i++)
-	{	// Loop for all the bytes
-		uint8_t charByte = curFont.glyphs[i];
-
+static unsigned ST7565R_glyphIndex(const ST7565R_Font* font, uint32_t codepoint){
+	// Find a font's glyph for a code point. Fonts with a range table get a binary search, so lookups
+	// stay O(log n) however many symbols the font carries. Unknown characters get the fallback glyph.
+	if (font->ranges == NULL)
+	{
+		if (codepoint < (uint8_t)font->firstChar || codepoint > (uint8_t)font->lastChar) {return font->fallbackGlyph;}
+		return codepoint - (uint8_t)font->firstChar;
+	}
 
-		for (int j = 0; j < 8; j++)
-		{	//Loop for each individual bit
-			width = x - originalX;
-			if (width < curFont.width)
-			{	// Validation for not extending past char's width
-				bool drawOrErase = (0b10000000 & (charByte << j)) != 0;
-				ST7565R_addPixelToCurScreen(drawOrErase, x, y);
-			}
-			x++;
+	int low = 0;
+	int high = font->numRanges - 1;
+	while (low <= high)
+	{
+		int mid = (low + high) / 2;
+		const ST7565R_GlyphRange* range = &font->ranges[mid];
+		if (codepoint < range->first)
+		{
+			high = mid - 1;
 		}
-
-		iterateRowTest++;
-		if (iterateRowTest % bytesPerRow == 0)
-		{	//Test for Next Line/Row
-			x = originalX;
-			y++;
+		else if (codepoint > range->last)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			return range->glyph + (codepoint - range->first);
 		}
 	}
+	return font->fallbackGlyph;
 }
 
-static void ST7565R_addPixelToCurScreen(ST7565R_DrawState drawOrErase, unsigned x, unsigned y){
-	if (x >= SCREENWIDTH) 	{return;}
-	if (y >= SCREENHEIGHT)	{return;}
-
-	int byteIndex = (SCREENWIDTH * (y / 8)) + x;
-	uint8_t newByte = curScreen[byteIndex];
-	switch(drawOrErase)
-	{
-	case ERASE:
-		newByte &= ~(0b00000001 << (y % 8));
-		break;
+static unsigned ST7565R_codepointAdvance(const ST7565R_Font* font, uint32_t codepoint){
+	// Columns the cursor moves for a character in a font, matching paintString
+	if (codepoint == '\t') 		{return 2 * font->width;}
+	if (font->glyphTable == NULL) {return font->width;}
+	return font->glyphTable[ST7565R_glyphIndex(font, codepoint)].advance;
+}
 
-	case DRAW:
-	default:
-		newByte |= (0b00000001 << (y % 8));
-		break;
+static uint32_t ST7565R_decodeUTF8(const char** string){
+	// Decode one UTF-8 character and move the string past it. Malformed sequences consume a single
+	// byte and return U+FFFD, which no font maps, so they paint as the fallback glyph.
+	const uint8_t* s = (const uint8_t*)*string;
+	uint32_t codepoint;
+	unsigned length;
+
+	if (s[0] < 0x80)				{codepoint = s[0];			length = 1;}
+	else if ((s[0] & 0xE0) == 0xC0)	{codepoint = s[0] & 0x1F;	length = 2;}
+	else if ((s[0] & 0xF0) == 0xE0)	{codepoint = s[0] & 0x0F;	length = 3;}
+	else if ((s[0] & 0xF8) == 0xF0)	{codepoint = s[0] & 0x07;	length = 4;}
+	else							{*string += 1; return 0xFFFD;}
+
+	for (unsigned i = 1; i < length; i++)
+	{	// Continuation bytes carry 6 bits each. A NUL fails this test, so we never read past the end
+		if ((s[i] & 0xC0) != 0x80) {*string += 1; return 0xFFFD;}
+		codepoint = (codepoint << 6) | (s[i] & 0x3F);
 	}
-	curScreen[byteIndex] = newByte;
+	*string += length;
+	return codepoint;
 }
 
 
@@ -375,11 +3232,11 @@ static void ST7565R_addPixelToCurScreen(ST7565R_DrawState drawOrErase, unsigned
 ****************************************************/
 void ST7565R_configureFont(ST7565R_Font newFont)
 {	// Send a complete Font struct to this function to configure the current font
-	curFont.glyphs = newFont.glyphs;
-	curFont.width = newFont.width;
-	curFont.height = newFont.height;
-	curFont.firstChar = newFont.firstChar;
-	curFont.lastChar = newFont.lastChar;
+	curFont = newFont;
+}
+ST7565R_Font ST7565R_getFont(void)
+{	// Hand back the current font, so it can be restored after temporarily switching
+	return curFont;
 }
 void ST7565R_configureFontDefault(void){
 #if defined(USING_FONT_CRC)
@@ -388,7 +3245,10 @@ void ST7565R_configureFontDefault(void){
 		.width = 		CRCFONT_WIDTH,
 		.height = 		CRCFONT_HEIGHT,
 		.firstChar = 	CRCFONT_FIRSTCHAR,
-		.lastChar = 	CRCFONT_LASTCHAR
+		.lastChar = 	CRCFONT_LASTCHAR,
+		.ranges = 		fontCRCRanges,
+		.numRanges = 	CRCFONT_NUMRANGES,
+		.fallbackGlyph = CRCFONT_FALLBACK_GLYPH
 	};
 	ST7565R_configureFont(defaultFont);
 #endif
@@ -405,6 +3265,26 @@ void ST7565R_configureFontFlow(void){
 	ST7565R_configureFont(newFont);
 #endif
 }
+void ST7565R_configureFontProportional(void){
+#if defined(USING_FONT_CRC_PROP)
+	ST7565R_Font newFont = {
+		.glyphs = 		fontCRCPropBitmaps,
+		.width = 		CRCPROPFONT_MAXADVANCE,
+		.height = 		CRCPROPFONT_HEIGHT,
+		.firstChar = 	CRCPROPFONT_FIRSTCHAR,
+		.lastChar = 	CRCPROPFONT_LASTCHAR,
+		.glyphTable = 	fontCRCPropGlyphs,
+		.ascent = 		CRCPROPFONT_ASCENT,
+		.descent = 		CRCPROPFONT_DESCENT,
+#if defined(USING_FONT_CRC)
+		.ranges = 		fontCRCRanges,			// Converted from fontCRC, so glyph indices line up
+		.numRanges = 	CRCFONT_NUMRANGES,
+		.fallbackGlyph = CRCFONT_FALLBACK_GLYPH
+#endif
+	};
+	ST7565R_configureFont(newFont);
+#endif
+}
 void ST7565R_configureFontKlein(void){
 #if defined(USING_FONT_KLEIN)
 	ST7565R_Font newFont = {
@@ -440,27 +3320,42 @@ void ST7565R_initScreen(void)
 ****************************************************/
 void ST7565R_setup(void)
 {	// Initial Setup for ST7565R driver and screen
-#ifndef PAINT_IMMEDIATELY
+#if !defined(PAINT_IMMEDIATELY) && !defined(ST7565R_STRIP_MODE)
 	lastScreen = (uint8_t*) malloc(SCREENBYTES);
-	for (int i = 0; i < SCREENBYTES; i++)
-	{
-		lastScreen[i] = 0xFF;
-	}
+	memset(lastScreen, 0xFF, SCREENBYTES);
 #endif
+#if defined(ST7565R_STRIP_MODE)
+	drawableBottom = 0;							// No buffers at all, drawing only happens inside updateDisplay()
+	ST7565R_resetClip();
+	target = stripBuffers[0];
+#elif defined(ST7565R_DISPLAY_LIST)
+	target = pageStrip;							// No curScreen, pages are drawn one at a time
+#elif defined(ST7565R_FRAME_HANDOFF)
+	frames[0] = (uint8_t*) calloc(3, SCREENBYTES);
+	frames[1] = frames[0] + SCREENBYTES;
+	frames[2] = frames[1] + SCREENBYTES;
+	curScreen = frames[frameBack];
+	target = curScreen;
+#else
 	curScreen = (uint8_t*) malloc(SCREENBYTES);
-	for (int i = 0; i < SCREENBYTES; i++)
-	{
-		curScreen[i] = 0x00;
-	}
+	memset(curScreen, 0x00, SCREENBYTES);
+	target = curScreen;
+#endif
+	ST7565R_markDirtyRegion(0, 0, DRAWWIDTH, DRAWHEIGHT);	// lastScreen doesn't match anything yet
+#ifdef ST7565R_TILE_MAP
+	memset(tileMap, ST7565R_TILE_NONE, sizeof(tileMap));
+#endif
 	ST7565R_configureFontDefault();
 	ST7565R_digital_write(NHD_RES, LOW);
 	ST7565R_delay(100);
 	ST7565R_digital_write(NHD_RES, HIGH);
 	ST7565R_delay(100);
+	asleep = false;								// The reset took it out of sleep
 	ST7565R_initScreen();
 #ifndef PAINT_IMMEDIATELY
 	ST7565R_clearScreen();
 	ST7565R_updateDisplay();
+	ST7565R_flushFrame();
 #endif
 }
 
@@ -468,9 +3363,44 @@ void ST7565R_shutdown(void)
 {
 	ST7565R_clearScreen();
 	ST7565R_updateDisplay();
+	ST7565R_flushFrame();
 	ST7565R_command(ST7565R_CMD_DISPLAY_OFF);
+#if !defined(PAINT_IMMEDIATELY) && !defined(ST7565R_STRIP_MODE)
 	free(lastScreen);
+#endif
+#if defined(ST7565R_FRAME_HANDOFF)
+	free(frames[0]);
+#elif !defined(ST7565R_DISPLAY_LIST) && !defined(ST7565R_STRIP_MODE)
 	free(curScreen);
+#endif
+}
+
+void ST7565R_sleep(void)
+{	// Power save with the static indicator off, which the ST7565R treats as sleep: the oscillator, booster and LCD drive stop. The display
+	// RAM and every register are kept, and so are curScreen and lastScreen, so nothing needs resending on wake. Painting and updating
+	// still work while asleep, they refresh the display RAM for when it wakes. Turn the backlight down yourself, it's separate
+	ST7565R_lock();
+	if (!asleep)
+	{
+		ST7565R_command(ST7565R_CMD_SLEEP_MODE);							// Static indicator OFF, Double Byte: 1 of 2
+		ST7565R_command(ST7565R_CMD_STATIC_INDICATOR_REGISTER(0));		// Static indicator OFF, Double Byte: 2 of 2
+		ST7565R_command(ST7565R_CMD_DISPLAY_OFF);
+		ST7565R_command(ST7565R_CMD_DISPLAY_ALL_POINTS_ON);				// With the display off this enters power save
+		asleep = true;
+	}
+	ST7565R_unlock();
+}
+
+void ST7565R_wake(void)
+{	// Leave sleep: two command bytes instead of setup()'s reset and a whole screen of data. Losing VDD does lose the display RAM, call setup() then
+	ST7565R_lock();
+	if (asleep)
+	{
+		asleep = false;
+		ST7565R_command(ST7565R_CMD_DISPLAY_ALL_POINTS_OFF);				// Ends power save, the power circuits start again
+		ST7565R_command(ST7565R_CMD_DISPLAY_ON);
+	}
+	ST7565R_unlock();
 }
 
 /****************************************************
@@ -478,35 +3408,158 @@ void ST7565R_shutdown(void)
 ****************************************************/
 void ST7565R_setBacklight(uint8_t brightness)
 {	// Set the LED backlight of the screen to a specified brightness
-	if (brightness < 0)
-	{	// lower validation
-		brightness = 0;
-	}
-	else if (brightness > 100)
+	if (brightness > 100)
 	{	// upper validation
 		brightness = 100;
 	}
 
-	ST7565R_set_pwm(brightness);
+	ST7565R_critical_enter();
+	backlight.effect 		= BACKLIGHT_STEADY;
+	backlight.brightness 	= brightness;
+	backlight.level 		= (int32_t)brightness << 16;
+	backlight.idle 			= false;
+	backlight.idleTicks 	= 0;
+	ST7565R_set_pwm(backlightGamma[brightness]);
+	ST7565R_critical_exit();
+}
+
+void ST7565R_fadeBacklight(uint8_t brightness, uint16_t durationMs)
+{	// Glide from the current brightness to a new one
+	if (brightness > 100) {brightness = 100;}
+
+	ST7565R_critical_enter();
+	backlight.brightness 	= brightness;
+	backlight.idle 			= false;
+	backlight.idleTicks 	= 0;
+	ST7565R_startBacklightFade(brightness, ST7565R_msToTicks(durationMs));
+	ST7565R_critical_exit();
+}
+
+void ST7565R_breatheBacklight(uint8_t low, uint8_t high, uint16_t periodMs)
+{	// Fade up and down between two brightnesses forever, periodMs for one whole breath
+	if (high > 100) {high = 100;}
+	if (low > high) {low = high;}
+	uint32_t half = ST7565R_msToTicks(periodMs / 2);
+	if (half > UINT16_MAX) {half = UINT16_MAX;}
+	int32_t step = (((int32_t)(high - low)) << 16) / (int32_t)half;	// The only division, the tick just adds
+
+	ST7565R_critical_enter();
+	backlight.effect 		= BACKLIGHT_BREATHE;
+	backlight.brightness 	= high;
+	backlight.low 			= low;
+	backlight.high 			= high;
+	backlight.level 		= (int32_t)low << 16;
+	backlight.step 			= step;
+	backlight.ticks[0] 		= half;
+	backlight.ticksLeft 	= half;
+	backlight.idle 			= false;
+	backlight.idleTicks 	= 0;
+	ST7565R_set_pwm(backlightGamma[low]);
+	ST7565R_critical_exit();
+}
+
+void ST7565R_blinkBacklight(uint8_t brightness, uint16_t onMs, uint16_t offMs)
+{	// Blink the backlight between off and a brightness
+	if (brightness > 100) {brightness = 100;}
+	uint32_t on = ST7565R_msToTicks(onMs);
+	uint32_t off = ST7565R_msToTicks(offMs);
+
+	ST7565R_critical_enter();
+	backlight.effect 		= BACKLIGHT_BLINK;
+	backlight.brightness 	= brightness;
+	backlight.high 			= brightness;
+	backlight.level 		= (int32_t)brightness << 16;
+	backlight.lit 			= true;
+	backlight.ticks[0] 		= (on > UINT16_MAX) ? UINT16_MAX : on;
+	backlight.ticks[1] 		= (off > UINT16_MAX) ? UINT16_MAX : off;
+	backlight.ticksLeft 	= backlight.ticks[0];
+	backlight.idle 			= false;
+	backlight.idleTicks 	= 0;
+	ST7565R_set_pwm(backlightGamma[brightness]);
+	ST7565R_critical_exit();
+}
+
+void ST7565R_setBacklightIdle(uint16_t timeoutSeconds, uint8_t dimBrightness, ST7565R_IdlePolicy policy)
+{	// Dim after timeoutSeconds without ST7565R_backlightActivity(), 0 turns it off. policy can pick the dim brightness instead (NULL uses dimBrightness)
+	if (dimBrightness > 100) {dimBrightness = 100;}
+
+	ST7565R_critical_enter();
+	backlight.idleTimeout 		= (uint32_t)timeoutSeconds * ST7565R_BACKLIGHT_TICK_HZ;
+	backlight.idleBrightness 	= dimBrightness;
+	backlight.idlePolicy 		= policy;
+	backlight.idleTicks 		= 0;
+	ST7565R_critical_exit();
 }
-void ST7565R_blinkBacklight(float oscillationSpeed)
-{	// Oscillate the brightness of the LED Backlight.
-	static int16_t tempBright = 0;
-	static int8_t dir = 1;
-	tempBright += dir * oscillationSpeed;
 
-	if (tempBright >= 100)
-	{	// Test for upper limit & send back down
-		tempBright = 100;
-		dir = -1;
+void ST7565R_backlightActivity(void)
+{	// Call on a button press or anything else that means someone is looking. Restarts the idle timer and brings the backlight back up
+	ST7565R_critical_enter();
+	backlight.idleTicks = 0;
+	if (backlight.idle)
+	{
+		backlight.idle = false;
+		ST7565R_startBacklightFade(backlight.brightness, ST7565R_msToTicks(ST7565R_BACKLIGHT_DIM_MS));
+	}
+	ST7565R_critical_exit();
+}
+
+void ST7565R_backlightTick(void)
+{	// Call from a timer interrupt ST7565R_BACKLIGHT_TICK_HZ times a second. Runs the effect and the idle timer, integer adds and a table lookup
+	if (backlight.idleTimeout != 0 && !backlight.idle && ++backlight.idleTicks >= backlight.idleTimeout)
+	{	// Nobody has done anything for a while, dim (this stops any effect)
+		backlight.idle = true;
+		uint8_t dim = (backlight.idlePolicy != NULL) ? backlight.idlePolicy(backlight.brightness) : backlight.idleBrightness;
+		ST7565R_startBacklightFade((dim > 100) ? 100 : dim, ST7565R_msToTicks(ST7565R_BACKLIGHT_DIM_MS));
 	}
-	else if (tempBright <= 0)
-	{	// Test for lower limit & send back up
-		tempBright = 0;
-		dir = 1;
+
+	switch (backlight.effect)
+	{
+	case BACKLIGHT_FADE:
+		backlight.level += backlight.step;
+		if (--backlight.ticksLeft == 0)
+		{	// Land exactly on the target, the step was rounded down
+			backlight.level = (int32_t)backlight.high << 16;
+			backlight.effect = BACKLIGHT_STEADY;
+		}
+		break;
+
+	case BACKLIGHT_BREATHE:
+		backlight.level += backlight.step;
+		if (--backlight.ticksLeft == 0)
+		{	// Turn around at the top or bottom, landing exactly on it so rounding never drifts
+			backlight.level = (int32_t)((backlight.step > 0) ? backlight.high : backlight.low) << 16;
+			backlight.step = -backlight.step;
+			backlight.ticksLeft = backlight.ticks[0];
+		}
+		break;
+
+	case BACKLIGHT_BLINK:
+		if (--backlight.ticksLeft != 0) {return;}
+		backlight.lit = !backlight.lit;
+		backlight.ticksLeft = backlight.ticks[backlight.lit ? 0 : 1];
+		backlight.level = backlight.lit ? ((int32_t)backlight.high << 16) : 0;
+		break;
+
+	default:
+		return;
 	}
 
-	ST7565R_set_pwm(tempBright);
+	ST7565R_set_pwm(backlightGamma[backlight.level >> 16]);
+}
+
+static void ST7565R_startBacklightFade(uint8_t brightness, uint32_t ticks)
+{	// Call inside a critical section. Works out the step here, so the tick never divides
+	if (ticks > UINT16_MAX) {ticks = UINT16_MAX;}
+	backlight.high 		= brightness;
+	backlight.step 		= (((int32_t)brightness << 16) - backlight.level) / (int32_t)ticks;
+	backlight.ticksLeft = ticks;
+	backlight.effect 	= BACKLIGHT_FADE;
+}
+
+static uint32_t ST7565R_msToTicks(uint32_t ms)
+{	// At least one tick, so effects always end
+	uint32_t ticks = (ms * ST7565R_BACKLIGHT_TICK_HZ) / 1000;
+	return (ticks == 0) ? 1 : ticks;
 }
 
 /****************************************************
@@ -515,7 +3568,7 @@ void ST7565R_blinkBacklight(float oscillationSpeed)
 void ST7565R_screenTest(void)
 {
 	ST7565R_setBacklight(70);
-	ST7565R_paintFullscreenBitmap(bmp_crcLeft());
+	ST7565R_paintAsset(&asset_crcLeft, 0, 0, 0);
 	return;
 	unsigned testX = 0;
 	unsigned testY = 0;
@@ -525,11 +3578,11 @@ void ST7565R_screenTest(void)
 		ST7565R_delay(10);
 		ST7565R_paintPixel(testBool, testX, testY);
 		testX++;
-		if (testX == SCREENWIDTH)
+		if (testX == DRAWWIDTH)
 		{
 			testX = 0;
 			testY++;
-			if (testY == SCREENHEIGHT)
+			if (testY == DRAWHEIGHT)
 			{
 				testY = 0;
 				testBool = !testBool;
@@ -538,6 +3591,172 @@ void ST7565R_screenTest(void)
 	}
 }
 
+#ifdef ST7565R_SELF_CHECK
+ST7565R_CheckStats ST7565R_selfCheck(uint32_t rounds, uint32_t seed)
+{	// Paint random primitives, each under a random clip or viewport half the time, and after every one check the screen against
+	// checkScreen, where the same thing was drawn a pixel at a time straight from the definitions. Every primitive overwrites its box,
+	// so a mismatch shows up however the fast path got it wrong. A mismatched round copies the screen over so the next one starts even
+	ST7565R_CheckStats stats;
+	memset(&stats, 0, sizeof(stats));
+	stats.firstFailure 		= UINT32_MAX;
+	uint32_t state 			= (seed == 0) ? 1 : seed;
+	static const char characters[] = "0123456789ABWgjpy%.:- ";
+
+	ST7565R_lock();
+	ST7565R_resetClip();
+	ST7565R_clearScreen();
+	memset(checkScreen, 0, sizeof(checkScreen));
+	for (uint32_t round = 0; round < rounds; round++)
+	{
+		ST7565R_CheckPrimitive primitive = (ST7565R_CheckPrimitive)(ST7565R_checkRandom(&state) % CHECK_PRIMITIVES);
+		switch (ST7565R_checkRandom(&state) % 4)
+		{	// Origins run off the top left so the far side of the clip gets tested too
+		case 0: ST7565R_pushViewport((int)(ST7565R_checkRandom(&state) % (DRAWWIDTH + 16)) - 16, (int)(ST7565R_checkRandom(&state) % (DRAWHEIGHT + 16)) - 16,
+									 1 + (ST7565R_checkRandom(&state) % DRAWWIDTH), 1 + (ST7565R_checkRandom(&state) % DRAWHEIGHT)); break;
+		case 1: ST7565R_pushClip((int)(ST7565R_checkRandom(&state) % DRAWWIDTH), (int)(ST7565R_checkRandom(&state) % DRAWHEIGHT),
+								 1 + (ST7565R_checkRandom(&state) % DRAWWIDTH), 1 + (ST7565R_checkRandom(&state) % DRAWHEIGHT)); break;
+		default: break;
+		}
+		unsigned x 		= ST7565R_checkRandom(&state) % (DRAWWIDTH + 8);
+		unsigned y 		= ST7565R_checkRandom(&state) % (DRAWHEIGHT + 8);
+		int screenX 	= (int)x + viewport.originX;
+		int screenY 	= (int)y + viewport.originY;
+		bool draw 		= (ST7565R_checkRandom(&state) % 4) != 0;
+		unsigned width 	= 1 + (ST7565R_checkRandom(&state) % 21);
+		unsigned height = 1 + (ST7565R_checkRandom(&state) % 24);			// Anything but multiples of 8 is where the page math goes wrong
+		unsigned scale 	= 2 + (ST7565R_checkRandom(&state) % (ST7565R_SCALE_MAX - 1));
+		uint8_t bitmap[21 * 3];
+		char string[5];
+		for (unsigned i = 0; i < sizeof(bitmap); i++) {bitmap[i] = (uint8_t)ST7565R_checkRandom(&state);}
+		unsigned length = 1 + (ST7565R_checkRandom(&state) % (sizeof(string) - 1));
+		for (unsigned i = 0; i < length; i++) {string[i] = characters[ST7565R_checkRandom(&state) % (sizeof(characters) - 1)];}
+		string[length] = '\0';
+
+		uint32_t start = ST7565R_trace_clock();
+		switch (primitive)
+		{
+		case CHECK_PIXEL: 			ST7565R_paintPixel(draw ? DRAW : ERASE, x, y); break;
+		case CHECK_RECTANGLE: 		ST7565R_paintRectangle(draw ? DRAW : ERASE, x, y, width, height); break;
+		case CHECK_BITMAP: 			ST7565R_paintBitmap(bitmap, x, y, width, height); break;
+		case CHECK_BITMAP_SCALED: 	ST7565R_paintBitmapScaled(bitmap, x, y, width, height, scale); break;
+		case CHECK_STRING: 			ST7565R_paintString(string, x, y); break;
+		default: 					ST7565R_paintStringScaled(string, x, y, scale); break;
+		}
+		uint32_t middle = ST7565R_trace_clock();
+		switch (primitive)
+		{
+		case CHECK_PIXEL: 			ST7565R_checkPixel(screenX, screenY, draw); break;
+		case CHECK_RECTANGLE:
+			for (unsigned row = 0; row < height; row++)
+			{
+				for (unsigned column = 0; column < width; column++) {ST7565R_checkPixel(screenX + (int)column, screenY + (int)row, draw);}
+			}
+			break;
+		case CHECK_BITMAP: 			ST7565R_checkBitmap(bitmap, screenX, screenY, width, height, 1); break;
+		case CHECK_BITMAP_SCALED: 	ST7565R_checkBitmap(bitmap, screenX, screenY, width, height, scale); break;
+		case CHECK_STRING: 			ST7565R_checkString(string, screenX, screenY, 1); break;
+		default: 					ST7565R_checkString(string, screenX, screenY, scale); break;
+		}
+		ST7565R_CheckResult* result = &stats.primitive[primitive];
+		result->referenceTicks 	+= ST7565R_trace_clock() - middle;
+		result->fastTicks 		+= middle - start;
+		result->runs++;
+		ST7565R_resetClip();
+
+		if (!ST7565R_checkCompare())
+		{
+			result->mismatches++;
+			if (stats.firstFailure == UINT32_MAX) {stats.firstFailure = round;}
+		}
+	}
+	ST7565R_clearScreen();
+	ST7565R_unlock();
+	return stats;
+}
+
+static uint32_t ST7565R_checkRandom(uint32_t* state){
+	// xorshift32, the same sequence on every compiler so a failing seed can be replayed anywhere
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static void ST7565R_checkPixel(int x, int y, bool on){
+	// Set or clear a pixel of checkScreen, in screen coordinates, if it's inside the clip
+	if (x < viewport.left || x >= viewport.right || y < viewport.top || y >= viewport.bottom) {return;}
+	uint8_t* dest = &checkScreen[((y / 8) * DRAWWIDTH) + x];
+	if (on)		{*dest |= (uint8_t)(0b00000001 << (y % 8));}
+	else		{*dest &= (uint8_t)~(0b00000001 << (y % 8));}
+}
+
+static void ST7565R_checkBitmap(const uint8_t* bitmap, int x, int y, unsigned width, unsigned height, unsigned scale){
+	// Reference for paintBitmap() and paintBitmapScaled(): each bitmap pixel becomes a scale x scale block
+	for (unsigned row = 0; row < height * scale; row++)
+	{
+		for (unsigned column = 0; column < width * scale; column++)
+		{
+			unsigned bitmapX = column / scale, bitmapY = row / scale;
+			bool on = (bitmap[((bitmapY / 8) * width) + bitmapX] >> (bitmapY % 8)) & 1;
+			ST7565R_checkPixel(x + (int)column, y + (int)row, on);
+		}
+	}
+}
+
+static void ST7565R_checkString(const char* string, int x, int y, unsigned scale){
+	// Reference for paintString() and paintStringScaled(), single byte characters only. Each glyph overwrites its whole box
+	for (; *string != '\0'; string++)
+	{
+		unsigned glyph = ST7565R_glyphIndex(&curFont, (uint8_t)*string);
+		if (curFont.glyphTable != NULL)
+		{	// Proportional glyphs are small vertical bitmaps
+			const ST7565R_Glyph* entry = &curFont.glyphTable[glyph];
+			const uint8_t* glyphData = ST7565R_glyphData(glyph);
+			if (glyphData != NULL) {ST7565R_checkBitmap(glyphData, x, y, entry->width, curFont.height, scale);}
+			x += entry->advance * scale;
+			continue;
+		}
+		unsigned bytesPerRow 	= font_num_bytes_per_row(curFont.width);
+		const uint8_t* charData = ST7565R_glyphData(glyph);
+		for (unsigned row = 0; row < curFont.height * scale && charData != NULL; row++)
+		{
+			for (unsigned column = 0; column < curFont.width * scale; column++)
+			{
+				unsigned glyphX = column / scale, glyphY = row / scale;
+				bool on = (charData[(glyphY * bytesPerRow) + (glyphX / 8)] & (0b10000000 >> (glyphX % 8))) != 0;
+				ST7565R_checkPixel(x + (int)column, y + (int)row, on);
+			}
+		}
+		x += curFont.width * scale;
+	}
+}
+
+static bool ST7565R_checkCompare(void){
+	// Does what the paint functions drew match checkScreen? Reads each pixel through the same turn addPixelToCurScreen() makes.
+	// On a mismatch checkScreen takes the screen's pixels, so one bug doesn't fail every round after it
+	bool match = true;
+	for (int y = 0; y < DRAWHEIGHT; y++)
+	{
+		for (int x = 0; x < DRAWWIDTH; x++)
+		{
+#if defined(ST7565R_ROTATE_90)
+			int column = y, row = SCREENHEIGHT - 1 - x;
+#elif defined(ST7565R_ROTATE_270)
+			int column = SCREENWIDTH - 1 - y, row = x;
+#else
+			int column = x, row = y;
+#endif
+			bool drawn 		= (ST7565R_targetPage(row / 8)[column] >> (row % 8)) & 1;
+			uint8_t* check 	= &checkScreen[((y / 8) * DRAWWIDTH) + x];
+			if (drawn == ((*check >> (y % 8)) & 1)) {continue;}
+			match = false;
+			*check ^= (uint8_t)(0b00000001 << (y % 8));
+		}
+	}
+	return match;
+}
+#endif
+
 
 
 
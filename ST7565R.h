@@ -60,8 +60,36 @@
 |		DEFINITION NAME							VALUE TYPE			VALUE 								SUGGESTED RANGE						DEFAULT VALUE			   |
 \**********************************************************************************************************************************************************************/
 //#define PAINT_IMMEDIATELY					 // Definition			UN/COMMENTED						 UN/COMMENTED						UNCOMMENTED
+//#define RETAIN_CURSCREEN					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_DISPLAY_LIST				 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_STRIP_MODE					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_STRIP_DOUBLE_BUFFER			 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_FRAME_HANDOFF				 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_SPRITES						 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_TILE_MAP					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_ROTATE_90					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_ROTATE_270				 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_TRACE						 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_GRAYSCALE					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_SELF_CHECK					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_SCRUB						 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
+//#define ST7565R_ASSET_PACK					 // Definition			UN/COMMENTED						 UN/COMMENTED						COMMENTED
 #define SCREENWIDTH								((uint16_t) 		128									)// 1 - 5000						128 pixels
 #define SCREENHEIGHT							((uint16_t)			32									)// 1 - 5000						32 	pixels
+#define ST7565R_CLIP_STACK_DEPTH				((uint8_t)			4									)// 1 - 255							4	clips
+#define ST7565R_RUN_GAP							((uint8_t)			2									)// 0 - 4							2	bytes
+#define ST7565R_NUMBER_CACHE_SIZE				((uint8_t)			4									)// 1 - 32							4	numbers
+#define ST7565R_DIGIT_STRIP_BYTES				((uint16_t)			320									)// 0 - 2000						320	bytes
+#define ST7565R_DISPLAY_LIST_SIZE				((uint8_t)			32									)// 2 - 255							32	commands
+#define ST7565R_DISPLAY_LIST_FONTS				((uint8_t)			4									)// 1 - 16							4	fonts
+#define ST7565R_BACKLIGHT_TICK_HZ				((uint16_t)			100									)// 10 - 1000						100	ticks/second
+#define ST7565R_BACKLIGHT_DIM_MS				((uint16_t)			500									)// 0 - 10000						500	milliseconds
+#define ST7565R_SPI_CLOCK_HZ					((uint32_t)			4000000								)// 100000 - 20000000				4000000	Hz
+#define ST7565R_TRACE_BUFFER					((uint16_t)			128									)// 70 - 4096						128	bytes
+#define ST7565R_TRACE_CLOCK_HZ				((uint32_t)			1000									)// 1000 - 100000000				1000	Hz
+#define ST7565R_SCRUB_COLUMNS					((uint8_t)			16									)// 1 - SCREENWIDTH					16	columns
+#define ST7565R_PACK_CACHE_SLOTS				((uint8_t)			4									)// 1 - 32							4	blocks
+#define ST7565R_PACK_CACHE_BYTES				((uint16_t)			64									)// 28 - 1024						64	bytes
 
 #if defined(ST7565R_USING_STM)
 #define	ST7565R_PWM_TIMER_CHANNEL									TIM2->CCR1							 // Configured Capture/Compare Register for a PWM
@@ -75,33 +103,156 @@
 *\		Comment out PAINT_IMMEDIATELY to use this driver in a different way. If you comment this out when you call the paint functions								  \*
 *\		it will only add them to the curScreen data structure. The driver will only paint to the display when you call ST7565R_updateDisplay();					 	  \*
 *\		One thing you can do is set up an interrupt on a timer to give our screen a specified frame rate. This reduces "flashing"				 					  \*
+*/  #pragma RETAIN_CURSCREEN																																	  /*
+*\		Uncomment RETAIN_CURSCREEN to keep curScreen after ST7565R_updateDisplay() instead of clearing it. You then only repaint what changes,	  \*
+*\		and updateDisplay() only looks at (and sends) the columns that were painted since the last update. The widgets need this.				  \*
+*/  #pragma ST7565R_DISPLAY_LIST																																  /*
+*\		Uncomment ST7565R_DISPLAY_LIST to have the paint functions only queue a small command instead of drawing. ST7565R_updateDisplay() then	  \*
+*\		draws the queued commands a page at a time into a one page strip, skipping commands that something later covers, and sends each page.	  \*
+*\		There's no curScreen, and queueing is safe from interrupts. Strings and bitmaps are drawn from your pointers, keep them until the update.  \*
+*\		Can't be used with PAINT_IMMEDIATELY, and like the default mode every update starts from a blank screen.									  \*
+*/  #pragma ST7565R_STRIP_MODE																																  /*
+*\		Uncomment ST7565R_STRIP_MODE to run without any screen buffers, only one page (SCREENWIDTH bytes) of RAM. Register a draw function with		  \*
+*\		ST7565R_setDrawCallback(). ST7565R_updateDisplay() calls it once per page with drawing clipped to that page, and sends each page as soon	  \*
+*\		as it's drawn. Paint only from inside the callback (anything else is clipped away), and draw the same thing for every page of an update.  \*
+*/  #pragma ST7565R_STRIP_DOUBLE_BUFFER																														  /*
+*\		ST7565R_STRIP_MODE: a second page buffer, so the next page is drawn while the last one goes out through ST7565R_spi_transmit_buffer_async  \*
+*/  #pragma ST7565R_FRAME_HANDOFF																																  /*
+*\		Uncomment ST7565R_FRAME_HANDOFF to draw in one task and send in another. ST7565R_updateDisplay() just publishes the finished frame and	  \*
+*\		returns without touching SPI, and the display task calls ST7565R_flushFrame() to send the newest published frame (older ones are skipped). \*
+*\		The handoff is lock free (one drawing task, one display task) and uses three frame buffers plus lastScreen. Needs C11 <stdatomic.h>		  \*
+*/  #pragma ST7565R_SPRITES																																	  /*
+*\		Uncomment ST7565R_SPRITES for masked sprites drawn over curScreen by ST7565R_updateDisplay(). curScreen stays the background, so a sprite	  \*
+*\		can move without anything underneath being repainted, and only its old and new boxes get compared and sent. Costs SCREENWIDTH bytes	  \*
+*/  #pragma ST7565R_TILE_MAP																																	  /*
+*\		Uncomment ST7565R_TILE_MAP to treat the screen as a grid of 8 column by 1 page cells, each showing a tile from ST7565R_setTileset().	  \*
+*\		Changing a cell only copies its 8 bytes in on the next update, so moving a menu cursor costs about 16 bytes. Works in every mode		  \*
+*/  #pragma ST7565R_ROTATE_90 / ST7565R_ROTATE_270																											  /*
+*\		Uncomment one of these for a panel mounted on its side (portrait). The paint functions then see a SCREENHEIGHT wide, SCREENWIDTH tall	  \*
+*\		screen, turned 90 or 270 degrees clockwise. Bitmaps are turned 8x8 bits at a time and glyph rows land as whole column bytes.		  \*
+*\		ST7565R_paintByte() still takes a panel column and page. Not with ST7565R_STRIP_MODE, ST7565R_DISPLAY_LIST, sprites or the tile map	  \*
+*/  #pragma ST7565R_TRACE																																		  /*
+*\		Uncomment ST7565R_TRACE to record every byte sent to the display, with its A0 state, Chip Select periods and timestamps, into the sink	  \*
+*\		given to ST7565R_setTraceSink(). Replay a trace on a PC with tools/tracereplay.c to see the final image and what the traffic cost	  \*
+*/  #pragma ST7565R_GRAYSCALE																																	  /*
+*\		Uncomment ST7565R_GRAYSCALE for 4 gray levels under the black and white drawing (2 * SCREENBYTES more RAM). Call ST7565R_grayscaleTick()	  \*
+*\		from a timer at 150 Hz or more: it flicks between subframes and only sends the bytes that look different in the next one. Needs			  \*
+*\		RETAIN_CURSCREEN in the default buffered mode, landscape, no sprites. Check what your SPI clock allows with tools/graybench.c			  \*
+*/  #pragma ST7565R_SELF_CHECK																																  /*
+*\		Uncomment ST7565R_SELF_CHECK for ST7565R_selfCheck(), which paints random strings, bitmaps, rectangles and pixels under random clips and	  \*
+*\		viewports and checks each against a slow pixel at a time version (SCREENBYTES more RAM). Run it on the board or a PC after changing the	  \*
+*\		rasterizers. Not with ST7565R_DISPLAY_LIST or ST7565R_STRIP_MODE, nothing is drawn until the update there									  \*
+*/  #pragma ST7565R_SCRUB																																	  /*
+*\		Uncomment ST7565R_SCRUB for ST7565R_scrubTick(), which rewrites the next ST7565R_SCRUB_COLUMNS bytes of display RAM from what the driver	  \*
+*\		last sent each time it's called. Updates only send what changed, so RAM hit by ESD or a brownout otherwise stays wrong until that spot	  \*
+*\		is painted again. A full pass takes SCREENBYTES / ST7565R_SCRUB_COLUMNS ticks. Not with ST7565R_STRIP_MODE, there's nothing to copy from	  \*
+*/  #pragma ST7565R_SCRUB_COLUMNS																																  /*
+*\		ST7565R_SCRUB: display RAM bytes each ST7565R_scrubTick() rewrites. Each tick costs these plus 3 command bytes							  \*
+*/  #pragma ST7565R_ASSET_PACK																																  /*
+*\		Uncomment ST7565R_ASSET_PACK to paint fonts and animations from a pack made by tools/bmpconv.c or tools/fontconv.c -p, kept outside the	  \*
+*\		MCU's flash. Mapped packs (QSPI flash in memory, mmap on a PC) are used in place, packs behind a read function (SPI flash, a file) are	  \*
+*\		fetched a glyph or a few frame columns at a time through a small cache. See ST7565R_packOpen()											  \*
+*/  #pragma ST7565R_PACK_CACHE_SLOTS																																  /*
+*\		ST7565R_ASSET_PACK: blocks of a pack kept in RAM, the least recently used is read over. A few let a string's glyphs repeat from RAM		  \*
+*/  #pragma ST7565R_PACK_CACHE_BYTES																																  /*
+*\		ST7565R_ASSET_PACK: bytes read into each block. Must hold the biggest glyph of a streamed font (pages * width), bigger reads ahead more	  \*
 */  #pragma SCREENWIDTH 																																 			  /*
 *\		Configure this to the width of your screen in pixels																						  				  \*
 */  #pragma SCREENHEIGHT																																  			  /*
 *\		Configure this to the height of your screen in pixels																										  \*
+*/  #pragma ST7565R_CLIP_STACK_DEPTH																																  /*
+*\		How many clips/viewports can be pushed at once (ST7565R_pushClip/ST7565R_pushViewport). Each level costs 12 bytes of RAM					  \*
+*/  #pragma ST7565R_RUN_GAP																																	  /*
+*\		Unchanged bytes between two changes that get resent anyway, since skipping them costs two column address commands						  \*
+*/  #pragma ST7565R_NUMBER_CACHE_SIZE																															  /*
+*\		How many places ST7565R_paintInt/ST7565R_paintFixed remember the last number painted at, so only the characters that changed get repainted  \*
+*/  #pragma ST7565R_DIGIT_STRIP_BYTES																															  /*
+*\		RAM for the font's digits turned into a vertical strip (13 characters * width * pages). Fonts that don't fit paint glyph by glyph instead	  \*
+*/  #pragma ST7565R_DISPLAY_LIST_SIZE																															  /*
+*\		ST7565R_DISPLAY_LIST: commands that can be queued between updates (24 bytes each). Commands queued while it's full are dropped			  \*
+*/  #pragma ST7565R_DISPLAY_LIST_FONTS																															  /*
+*\		ST7565R_DISPLAY_LIST: different fonts that can be used between updates																		  \*
+*/  #pragma ST7565R_BACKLIGHT_TICK_HZ																															  /*
+*\		How often your timer interrupt calls ST7565R_backlightTick(). Fade, breathe, blink and idle times are counted in these ticks				  \*
+*/  #pragma ST7565R_BACKLIGHT_DIM_MS																															  /*
+*\		How long the backlight takes to fade down when idle (ST7565R_setBacklightIdle) and back up on ST7565R_backlightActivity()				  \*
+*/  #pragma ST7565R_SPI_CLOCK_HZ																																  /*
+*\		SPI clock, used to turn ST7565R_updateDisplayBudget() microseconds into bytes. A byte takes 8 clocks, a command costs the same as data		  \*
+*/  #pragma ST7565R_TRACE_BUFFER																																  /*
+*\		ST7565R_TRACE: RAM the trace is gathered in before it goes to the sink. Smaller hands the sink less at a time, more often		  \*
+*/  #pragma ST7565R_TRACE_CLOCK_HZ																															  /*
+*\		ST7565R_TRACE: rate of ST7565R_trace_clock(), written into the trace. HAL_GetTick() counts milliseconds, use a faster timer for finer timing	  \*
 */	#pragma ST7565R_PWM_TIMER_CHANNEL																														 		  /*
 *\		STM: Configure this to the Capture/Compare Register in your timer that you have configured Pulse Width Modulation for. This is for the backlight.   				  \*
+*\		The driver writes duty cycles from 0 to 65535, so set the timer's period (auto-reload) to 65535												  \*
 */  #pragma ST7565R_SPI																																				  /*
 *\		STM: Configure this to the spi structure thats configured to your screen.																	  								  \*
 \**********************************************************************************************************************************************************************/
 
 
 #if defined(ST7565R_USING_STM)
-#define ST7565R_set_pwm(dutyCycle)							ST7565R_PWM_TIMER_CHANNEL = (uint32_t)dutyCycle*655.35		/*TODO: Configure Me */
+#define ST7565R_set_pwm(dutyCycle)							ST7565R_PWM_TIMER_CHANNEL = (uint32_t)(dutyCycle)			/*TODO: Configure Me (dutyCycle is 0 - 65535) */
 #define ST7565R_spi_transmit(data)							HAL_SPI_Transmit(&ST7565R_SPI, &data, 1, HAL_MAX_DELAY)		/*TODO: Configure Me */
+#define ST7565R_spi_transmit_buffer(data, size)				HAL_SPI_Transmit(&ST7565R_SPI, (uint8_t*)(data), size, HAL_MAX_DELAY)	/*TODO: Configure Me */
+#define ST7565R_spi_transmit_buffer_async(data, size)		HAL_SPI_Transmit_DMA(&ST7565R_SPI, (uint8_t*)(data), size)				/*TODO: Configure Me */
+#define ST7565R_spi_wait()									while (HAL_SPI_GetState(&ST7565R_SPI) != HAL_SPI_STATE_READY) {}		/*TODO: Configure Me */
+#define ST7565R_critical_enter()							uint32_t ST7565R_primask = __get_PRIMASK(); __disable_irq()
+#define ST7565R_critical_exit()								__set_PRIMASK(ST7565R_primask)
 
 #define ST7565R_digital_write(portPin, highLow) 			HAL_GPIO_WritePin(portPin.port, portPin.pin, highLow)
 #define ST7565R_delay(delayTime)							HAL_Delay(delayTime)
+#define ST7565R_trace_clock()								HAL_GetTick()		/*TODO: Configure Me */
 #elif defined(ST7565R_USING_ATMEL)
 #define ST7565R_set_pwm(dutyCycle)							/*TODO: Configure for Atmel*/
 #define ST7565R_digital_write(portPin, highLow) 			/*TODO: Configure for Atmel*/
 #define ST7565R_delay(delayTime)							delay_ms(delayTime);
+#define ST7565R_trace_clock()								0					/*TODO: Configure for Atmel*/
 #define ST7565R_spi_transmit(spi, data, size, timeout)		/*TODO: Configure for Atmel*/
+#define ST7565R_spi_transmit_buffer(data, size)				/*TODO: Configure for Atmel*/
+#define ST7565R_spi_transmit_buffer_async(data, size)		/*TODO: Configure for Atmel*/
+#define ST7565R_spi_wait()									/*TODO: Configure for Atmel*/
+#define ST7565R_critical_enter()							irqflags_t ST7565R_irqFlags = cpu_irq_save()
+#define ST7565R_critical_exit()								cpu_irq_restore(ST7565R_irqFlags)
 #else
 #define ST7565R_set_pwm(dutyCycle)							/*TODO: Configure this function to your own architecture*/
 #define ST7565R_digital_write(portPin, highLow) 			/*TODO: Configure this function to your own architecture*/
 #define ST7565R_delay(delayTime)							/*TODO: Configure this function to your own architecture*/
+#define ST7565R_trace_clock()								0					/*TODO: Configure this function to your own architecture*/
 #define ST7565R_spi_transmit(spi, data, size, timeout)		/*TODO: Configure this function to your own architecture*/
+#define ST7565R_spi_transmit_buffer(data, size)				/*TODO: Configure this function to your own architecture*/
+#define ST7565R_spi_transmit_buffer_async(data, size)		/*TODO: Configure this function to your own architecture*/
+#define ST7565R_spi_wait()									/*TODO: Configure this function to your own architecture*/
+#define ST7565R_critical_enter()							/*TODO: Configure this function to your own architecture*/
+#define ST7565R_critical_exit()								/*TODO: Configure this function to your own architecture*/
+#endif
+
+#if defined(ST7565R_DISPLAY_LIST) && defined(PAINT_IMMEDIATELY)
+#error "ST7565R_DISPLAY_LIST queues drawing until ST7565R_updateDisplay(), it can't be used with PAINT_IMMEDIATELY"
+#endif
+#if defined(ST7565R_STRIP_MODE) && (defined(PAINT_IMMEDIATELY) || defined(ST7565R_DISPLAY_LIST))
+#error "ST7565R_STRIP_MODE draws from its callback during ST7565R_updateDisplay(), it can't be used with PAINT_IMMEDIATELY or ST7565R_DISPLAY_LIST"
+#endif
+#if defined(ST7565R_FRAME_HANDOFF) && (defined(PAINT_IMMEDIATELY) || defined(ST7565R_DISPLAY_LIST) || defined(ST7565R_STRIP_MODE))
+#error "ST7565R_FRAME_HANDOFF hands whole frames to ST7565R_flushFrame(), it only works with the default buffered mode"
+#endif
+#if defined(ST7565R_SPRITES) && (defined(PAINT_IMMEDIATELY) || defined(ST7565R_DISPLAY_LIST) || defined(ST7565R_STRIP_MODE) || defined(ST7565R_FRAME_HANDOFF))
+#error "ST7565R_SPRITES composites over curScreen in ST7565R_updateDisplay(), it only works with the default buffered mode"
+#endif
+#if defined(ST7565R_ROTATE_90) && defined(ST7565R_ROTATE_270)
+#error "Uncomment only one of ST7565R_ROTATE_90 and ST7565R_ROTATE_270"
+#endif
+#if (defined(ST7565R_ROTATE_90) || defined(ST7565R_ROTATE_270)) && (defined(ST7565R_STRIP_MODE) || defined(ST7565R_DISPLAY_LIST) || defined(ST7565R_SPRITES) || defined(ST7565R_TILE_MAP))
+#error "ST7565R_ROTATE_90/270 turn what's drawn into curScreen, they work with the default buffered mode, PAINT_IMMEDIATELY and ST7565R_FRAME_HANDOFF"
+#endif
+#if defined(ST7565R_GRAYSCALE) && (!defined(RETAIN_CURSCREEN) || defined(PAINT_IMMEDIATELY) || defined(ST7565R_DISPLAY_LIST) || defined(ST7565R_STRIP_MODE) || \
+	defined(ST7565R_FRAME_HANDOFF) || defined(ST7565R_SPRITES) || defined(ST7565R_ROTATE_90) || defined(ST7565R_ROTATE_270))
+#error "ST7565R_GRAYSCALE lays its planes under a retained curScreen as it sends, it needs RETAIN_CURSCREEN in the default buffered mode, landscape and without sprites"
+#endif
+#if defined(ST7565R_SCRUB) && defined(ST7565R_STRIP_MODE)
+#error "ST7565R_SCRUB rewrites display RAM from lastScreen, and ST7565R_STRIP_MODE doesn't keep one"
+#endif
+#if defined(ST7565R_SELF_CHECK) && (defined(ST7565R_DISPLAY_LIST) || defined(ST7565R_STRIP_MODE))
+#error "ST7565R_SELF_CHECK compares what the paint functions leave in curScreen, it can't be used with ST7565R_DISPLAY_LIST or ST7565R_STRIP_MODE"
 #endif
 
 /*****************************************************
@@ -116,6 +267,30 @@
 // Definitions
 #define SCREENPAGES											ST7565R_num_pages_from_height(SCREENHEIGHT)
 #define SCREENBYTES											SCREENPAGES * SCREENWIDTH
+#if defined(ST7565R_ROTATE_90) || defined(ST7565R_ROTATE_270)
+#define ST7565R_PORTRAIT
+#define DRAWWIDTH											SCREENHEIGHT	// The screen as the paint functions see it
+#define DRAWHEIGHT											SCREENWIDTH
+#else
+#define DRAWWIDTH											SCREENWIDTH
+#define DRAWHEIGHT											SCREENHEIGHT
+#endif
+#define ST7565R_FRAME_FRESH									0x80		// Set on the shared frame index once it has been published
+#define ST7565R_NUMBER_MAX_CHARS							16			// Longest number paintFixed() paints, sign and point included
+#define ST7565R_NUMBER_MINUS								10			// Digit strip indices of the characters that aren't digits
+#define ST7565R_NUMBER_POINT								11
+#define ST7565R_NUMBER_SPACE								12
+#define ST7565R_TILE_COLUMNS								((SCREENWIDTH + 7) / 8)	// Cells across the tile map
+#define ST7565R_TILE_NONE									0xFF		// Cell left alone by the tile map, other painting shows there
+#define ST7565R_ASSET_CHUNK									16			// Columns of an ASSET_RLE page decoded at a time, on the stack
+#define ST7565R_SCALE_MAX									4			// Largest factor of the paint...Scaled() functions
+#define ST7565R_SCALE_CHUNK									32			// Columns of a scaled page built at a time, on the stack (times ST7565R_SCALE_MAX pages)
+#define ST7565R_TRACE_VERSION								1			// Trace format, see tools/tracereplay.c
+#define ST7565R_TRACE_RECORD_MAX							64			// Bytes in one trace record
+#define ST7565R_GRAY_SUBFRAMES								3			// Subframes in a gray cycle, level n shows in n of them
+#define ST7565R_PACK_VERSION								1			// Asset pack format, see tools/bmpconv.c
+#define ST7565R_PACK_HEADER_BYTES							16
+#define ST7565R_PACK_ENTRY_BYTES							28
 
 /****************************************************
 *              COMMANDS				                *
@@ -148,8 +323,9 @@
 #define ST7565R_CMD_VOLTAGE_RESISTOR_RATIO_6        0x26
 #define ST7565R_CMD_VOLTAGE_RESISTOR_RATIO_7        0x27
 #define ST7565R_CMD_POWER_CTRL_ALL_ON               0x2F
-#define ST7565R_CMD_SLEEP_MODE                      0xAC
-#define ST7565R_CMD_NORMAL_MODE                     0xAD
+#define ST7565R_CMD_SLEEP_MODE                      0xAC		// Static indicator OFF, double byte. Power save (DISPLAY_OFF then ALL_POINTS_ON) is then sleep
+#define ST7565R_CMD_NORMAL_MODE                     0xAD		// Static indicator ON, double byte. Power save is then standby
+#define ST7565R_CMD_STATIC_INDICATOR_REGISTER(mode) ((mode) & 0x03)	// Second byte of the two above: 0 off, 1 - 3 blink rates
 #define ST7565R_CMD_RESET                           0xE2
 #define ST7565R_CMD_NOP                             0xE3
 #define ST7565R_CMD_ELECTRONIC_VOLUME_MODE_SET      0x81
@@ -174,12 +350,31 @@ typedef struct ST7565R_STM_Pin {
 }ST7565R_STM_Pin;
 #endif
 
+typedef struct ST7565R_Glyph_Struct{
+	uint16_t offset;						// Index of the glyph's first byte in the font's packed glyph data
+	uint8_t width;							// Columns of bitmap data stored for this glyph (0 for blank glyphs)
+	uint8_t advance;						// Columns to move the cursor after painting this glyph
+} ST7565R_Glyph;
+
+typedef struct ST7565R_GlyphRange_Struct{
+	uint16_t first;							// First code point in the range
+	uint16_t last;							// Last code point in the range
+	uint16_t glyph;							// Glyph index of the range's first code point
+} ST7565R_GlyphRange;
+
 typedef struct ST7565R_Font_Struct{
-	uint8_t* glyphs;
-	uint8_t width;
+	const uint8_t* glyphs;
+	uint8_t width;							// Fixed fonts: glyph width. Proportional fonts: widest advance
 	uint8_t height;
 	char firstChar;
 	char lastChar;
+	const ST7565R_Glyph* glyphTable;		// Proportional fonts only, leave NULL for fixed width fonts
+	uint8_t ascent;							// Proportional fonts only, rows above the baseline
+	uint8_t descent;						// Proportional fonts only, rows below the baseline
+	const ST7565R_GlyphRange* ranges;		// Optional, sorted by code point. NULL means firstChar to lastChar
+	uint8_t numRanges;
+	uint16_t fallbackGlyph;					// Glyph index painted for characters the font doesn't have
+	const struct ST7565R_PackFont_Struct* stream;	// ST7565R_ASSET_PACK: glyphs fetched from a pack, glyphs is NULL. See ST7565R_packFont()
 } ST7565R_Font;
 
 typedef const enum{
@@ -187,6 +382,236 @@ typedef const enum{
 	DRAW
 } ST7565R_DrawState;
 
+typedef struct ST7565R_Viewport_Struct{
+	int16_t left;							// Clip rectangle in screen coordinates, right and bottom are exclusive
+	int16_t top;
+	int16_t right;
+	int16_t bottom;
+	int16_t originX;						// Screen position of the current (0,0)
+	int16_t originY;
+} ST7565R_Viewport;
+
+typedef struct ST7565R_NumberCache_Struct{
+	int16_t x;								// Screen position of the last number painted here
+	int16_t y;
+	const void* font;						// Font it was painted with, its glyph data or pack stream
+	uint8_t charWidth;
+	uint8_t height;
+	uint8_t length;							// Characters painted, 0 means the entry is free
+	uint8_t chars[ST7565R_NUMBER_MAX_CHARS];	// Digit strip index of each character
+} ST7565R_NumberCache;
+
+typedef enum{
+	COMMAND_BYTE,
+	COMMAND_PIXEL,
+	COMMAND_GLYPH,
+	COMMAND_STRING,
+	COMMAND_STRING_BOX,
+	COMMAND_BITMAP,
+	COMMAND_RECTANGLE,
+	COMMAND_NUMBER,
+	COMMAND_ASSET,
+	COMMAND_CIRCLE,
+	COMMAND_TRIANGLE,
+	COMMAND_POLYGON
+} ST7565R_CommandType;
+
+typedef enum{
+	CIRCLE_OUTLINE,
+	CIRCLE_FILLED,
+	CIRCLE_ARC
+} ST7565R_CircleShape;
+
+typedef struct ST7565R_Shape_Struct{		// What the scanline filler fills
+	const int16_t* points;					// Polygons: x,y pairs, NULL for a circle
+	uint16_t count;							// Polygons: number of points
+	int16_t x;								// Circles: centre in screen coordinates. Polygons: added to every point
+	int16_t y;
+	uint16_t radius;
+} ST7565R_Shape;
+
+typedef struct ST7565R_Command_Struct{
+	uint8_t type;							// ST7565R_CommandType
+	uint8_t font;							// Text and numbers: slot in the display list's font table
+	uint8_t param[2];						// Draw state | alignment and wrap | decimals and width | asset frame | circle shape, then scale for glyphs, strings and bitmaps
+	int16_t x;								// Screen position the command paints at, circles: centre, triangles: first point
+	int16_t y;
+	uint16_t width;							// Bitmaps, rectangles and string boxes. Circles: radius, polygons: points
+	uint16_t height;						// Triangles: the second point is in width and height
+	int16_t left;							// Bounds: the box the command can touch, already trimmed to the clip
+	int16_t top;
+	int16_t right;
+	int16_t bottom;
+	union {
+		const uint8_t* bitmap;
+		const char* string;
+		int32_t number;						// Numbers, and the byte for paintByte()
+		const struct ST7565R_Asset_Struct* asset;
+		const int16_t* points;				// Polygons
+		int16_t point[2];					// Triangles: the third point. Arcs: start and end angle
+	} data;
+} ST7565R_Command;
+
+typedef enum{
+	ASSET_RAW,								// width bytes per page, page after page, like paintBitmap()
+	ASSET_RLE,								// Control byte c, then c + 1 literal bytes (c < 0x80) or one byte repeated (c & 0x7F) + 1 times
+	ASSET_TILED								// One byte per 8 columns of each page, indexing the 8 byte tiles
+} ST7565R_AssetEncoding;
+
+typedef struct ST7565R_Asset_Struct{		// Made by tools/bmpconv.c, see bitmaps.h
+	uint16_t width;
+	uint16_t height;
+	uint16_t frames;
+	uint8_t encoding;						// ST7565R_AssetEncoding
+	const uint32_t* frameOffsets;			// Where each frame starts in data, identical frames share one
+	const uint8_t* data;
+	const uint8_t* tiles;					// ASSET_TILED only
+} ST7565R_Asset;
+
+typedef bool (*ST7565R_PackRead)(uint32_t offset, uint8_t* bytes, unsigned count, void* context);	// ST7565R_ASSET_PACK: reads count bytes of a pack
+
+typedef enum{
+	PACK_ASSET,								// An ST7565R_Asset, frames and all
+	PACK_FONT,								// Fixed width, horizontal glyphs like crcFont.h
+	PACK_FONT_PROPORTIONAL					// Vertical glyphs and a glyph table like crcPropFont.h
+} ST7565R_PackKind;
+
+typedef struct ST7565R_Pack_Struct{		// Made by tools/bmpconv.c and tools/fontconv.c -p, opened with ST7565R_packOpen() or ST7565R_packOpenMapped()
+	ST7565R_PackRead read;					// Block read backend, NULL for a mapped pack
+	void* context;
+	const uint8_t* mapped;					// Mapped backend: the whole pack, in memory
+	uint32_t size;							// Bytes in the pack
+	uint32_t index;							// Where the index starts
+	uint16_t count;							// Entries in the index
+} ST7565R_Pack;
+
+typedef struct ST7565R_PackEntry_Struct{	// One entry of a pack's index, all offsets are from the start of the pack
+	uint8_t kind;							// ST7565R_PackKind
+	uint8_t encoding;						// Assets: ST7565R_AssetEncoding
+	uint16_t width;							// Fixed fonts: glyph width. Proportional fonts: widest advance
+	uint16_t height;
+	uint16_t count;							// Frames or glyphs
+	uint8_t firstChar;						// Fonts only
+	uint8_t lastChar;
+	uint8_t ascent;							// Proportional fonts only
+	uint8_t descent;
+	uint32_t table;							// Assets: frame offsets. Proportional fonts: the glyph table. Both count from data
+	uint32_t data;							// Frames or glyphs
+	uint32_t length;						// Bytes of data
+	uint32_t tiles;							// ASSET_TILED only
+} ST7565R_PackEntry;
+
+typedef struct ST7565R_PackFont_Struct{	// Where a streamed font's glyphs are, keep it alive as long as the font is used
+	const ST7565R_Pack* pack;
+	uint32_t data;
+} ST7565R_PackFont;
+
+typedef struct ST7565R_PackSlot_Struct{	// A block of a pack read into RAM
+	const ST7565R_Pack* pack;				// NULL while free
+	uint32_t offset;
+	uint16_t length;
+	uint32_t used;							// Fetch it was last used by, the oldest block is read over
+	uint8_t bytes[ST7565R_PACK_CACHE_BYTES];
+} ST7565R_PackSlot;
+
+typedef struct ST7565R_PackStats_Struct{
+	uint32_t hits;							// Fetches served from a cached block
+	uint32_t misses;						// Fetches that had to read
+	uint32_t bytesRead;						// Through the read backends altogether
+} ST7565R_PackStats;
+
+typedef enum{
+	SPRITE_MASKED,							// Mask bits are cleared from the background, then bitmap bits set
+	SPRITE_XOR								// Bitmap bits invert the background, for cursors that show on anything
+} ST7565R_SpriteMode;
+
+typedef struct ST7565R_Sprite_Struct{
+	const uint8_t* bitmap;					// Vertically oriented like paintBitmap(), width * pages bytes
+	const uint8_t* mask;					// Same layout, set bits are opaque. NULL uses the bitmap as its own mask
+	int16_t x;								// Screen position, sprites ignore the clip and viewport
+	int16_t y;
+	uint8_t width;
+	uint8_t height;
+	uint8_t mode;							// ST7565R_SpriteMode
+	bool visible;
+	struct ST7565R_Sprite_Struct* next;		// Next sprite up, later sprites are drawn on top
+} ST7565R_Sprite;
+
+typedef enum{
+	BACKLIGHT_STEADY,
+	BACKLIGHT_FADE,
+	BACKLIGHT_BREATHE,
+	BACKLIGHT_BLINK
+} ST7565R_BacklightEffect;
+
+typedef uint8_t (*ST7565R_IdlePolicy)(uint8_t brightness);			// Returns the brightness to dim to once idle, given the normal brightness
+
+typedef struct ST7565R_Backlight_Struct{
+	uint8_t effect;							// ST7565R_BacklightEffect
+	bool lit;								// Blink: in the on phase
+	bool idle;								// Dimmed by the idle timer
+	uint8_t brightness;						// Brightness to come back to from idle, 0 - 100
+	uint8_t low;							// Breathe: bottom of the breath
+	uint8_t high;							// Fade: target. Breathe: top of the breath. Blink: on brightness
+	uint8_t idleBrightness;
+	int32_t level;							// Current brightness in 16.16 fixed point
+	int32_t step;							// Added to level every tick while fading or breathing
+	uint16_t ticksLeft;						// Until the fade ends, the breath turns or the blink toggles
+	uint16_t ticks[2];						// Breathe: ticks per half breath. Blink: on and off ticks
+	uint32_t idleTimeout;					// Ticks without activity before dimming, 0 turns it off
+	uint32_t idleTicks;
+	ST7565R_IdlePolicy idlePolicy;
+} ST7565R_Backlight;
+
+typedef struct ST7565R_FlushStats_Struct{
+	uint32_t lastBytes;						// Sent by the last update, data and commands
+	uint32_t lastBudget;					// Bytes it was allowed, UINT32_MAX for ST7565R_updateDisplay()
+	uint32_t maxBytes;						// Most any update has sent
+	uint32_t carriedOver;					// Budgeted updates that left dirty columns for the next one
+	uint32_t scrubBytes;					// ST7565R_SCRUB: sent by ST7565R_scrubTick() altogether, data and commands
+	uint32_t scrubPasses;					// ST7565R_SCRUB: times the whole display RAM has been rewritten
+} ST7565R_FlushStats;
+
+typedef struct ST7565R_GrayStats_Struct{	// ST7565R_GRAYSCALE: what ST7565R_grayscaleTick() costs
+	uint32_t lastBytes;						// Sent by the last tick, data and commands
+	uint32_t maxBytes;						// Most any tick has sent
+	uint32_t maxTickHz;						// Ticks a second the SPI keeps up with at maxBytes and ST7565R_SPI_CLOCK_HZ, 0 before any
+	uint32_t ticks;
+	uint32_t skipped;						// Ticks that found the driver locked (mid update) and sent nothing
+} ST7565R_GrayStats;
+
+typedef enum{								// ST7565R_SELF_CHECK: what ST7565R_selfCheck() paints
+	CHECK_PIXEL,
+	CHECK_RECTANGLE,
+	CHECK_BITMAP,
+	CHECK_BITMAP_SCALED,
+	CHECK_STRING,
+	CHECK_STRING_SCALED,
+	CHECK_PRIMITIVES						// How many there are
+} ST7565R_CheckPrimitive;
+
+typedef struct ST7565R_CheckResult_Struct{
+	uint32_t runs;
+	uint32_t mismatches;					// Runs that left the screen different from the reference
+	uint32_t fastTicks;						// ST7565R_trace_clock() ticks spent in the paint function
+	uint32_t referenceTicks;				// And in the pixel at a time reference
+} ST7565R_CheckResult;
+
+typedef struct ST7565R_CheckStats_Struct{
+	ST7565R_CheckResult primitive[CHECK_PRIMITIVES];
+	uint32_t firstFailure;					// Round of the first mismatch, UINT32_MAX if every round matched
+} ST7565R_CheckStats;
+
+typedef void (*ST7565R_DrawCallback)(uint8_t page, void* context);	// ST7565R_STRIP_MODE: paints the screen, page is the one being drawn
+typedef void (*ST7565R_LockHook)(void* context);					// Takes or gives back a recursive mutex
+typedef void (*ST7565R_TraceSink)(const uint8_t* bytes, unsigned count, void* context);	// ST7565R_TRACE: stores the next part of a trace
+
+typedef enum{
+	ALIGN_LEFT,
+	ALIGN_CENTER,
+	ALIGN_RIGHT
+} ST7565R_Align;
+
 typedef const enum
 {
   LOW = 0U,
@@ -200,39 +625,146 @@ typedef const enum
 // ST7565R functions
 void ST7565R_command						(uint8_t command);
 void ST7565R_paintByteHere					(uint8_t byte);
+void ST7565R_paintBytesHere					(const uint8_t* bytes, unsigned count);
 void ST7565R_paintByte						(uint8_t byte, unsigned column, unsigned page);
 void ST7565R_paintPixel						(ST7565R_DrawState drawOrErase, unsigned x, unsigned y);
-void ST7565R_paintString					(char* string, unsigned x, unsigned y);
+void ST7565R_paintString					(char* string, unsigned x, unsigned y);	// string is UTF-8
 void ST7565R_paintChar						(char c, unsigned x, unsigned y);
+void ST7565R_paintStringScaled				(char* string, unsigned x, unsigned y, unsigned scale);	// scale is 1 - ST7565R_SCALE_MAX
+void ST7565R_paintCharScaled				(char c, unsigned x, unsigned y, unsigned scale);
+void ST7565R_measureString					(char* string, unsigned* width, unsigned* height);
+void ST7565R_paintStringBox					(char* string, int x, int y, unsigned width, unsigned height, ST7565R_Align align, bool wrap);
 void ST7565R_paintFullscreenBitmap			(uint8_t* bitmap);
 void ST7565R_paintBitmap					(uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height);
+void ST7565R_paintBitmapScaled				(uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height, unsigned scale);
 void ST7565R_paintRectangle					(ST7565R_DrawState drawOrErase, unsigned x, unsigned y, unsigned width, unsigned height);
+void ST7565R_paintCircle					(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius);
+void ST7565R_paintFilledCircle				(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius);
+void ST7565R_paintArc						(ST7565R_DrawState drawOrErase, int x, int y, unsigned radius, int startAngle, int endAngle);	// Degrees, 0 is 3 o'clock, clockwise
+void ST7565R_paintTriangle					(ST7565R_DrawState drawOrErase, int x0, int y0, int x1, int y1, int x2, int y2);
+void ST7565R_paintPolygon					(ST7565R_DrawState drawOrErase, const int16_t* points, unsigned count);		// Filled, convex, x,y pairs
+void ST7565R_paintAsset						(const ST7565R_Asset* asset, unsigned frame, int x, int y);
+const uint8_t* ST7565R_assetBitmap			(const ST7565R_Asset* asset, unsigned frame);
 void ST7565R_clearScreen					(void);
 void ST7565R_updateDisplay					(void);
+bool ST7565R_updateDisplayBudget			(uint32_t maxMicroseconds);
+ST7565R_FlushStats ST7565R_getFlushStats	(void);
+void ST7565R_scrubTick						(void);		// ST7565R_SCRUB
+void ST7565R_markDirty						(int x, int y, unsigned width, unsigned height);
+uint16_t ST7565R_displayListDropped			(void);
+void ST7565R_setDrawCallback				(ST7565R_DrawCallback draw, void* context);
+bool ST7565R_flushFrame						(void);
 void ST7565R_initScreen						(void);
 void ST7565R_setup							(void);
 void ST7565R_shutdown						(void);
+void ST7565R_sleep							(void);		// Display off, controller in sleep, display RAM and the driver's buffers kept
+void ST7565R_wake							(void);		// Back on as it was, plus whatever was painted and updated while asleep
+
+// Clip & Viewport Functions (every paint function is trimmed to the clip and offset by the viewport's origin)
+bool ST7565R_pushClip						(int x, int y, unsigned width, unsigned height);
+bool ST7565R_pushViewport					(int x, int y, unsigned width, unsigned height);
+void ST7565R_popClip						(void);
+void ST7565R_resetClip						(void);
+
+#ifdef ST7565R_SPRITES
+// Sprite Functions. The sprite structs are yours, keep them alive while they're added. Change them through
+// these functions so the box they leave and the box they move to get sent on the next updateDisplay()
+bool ST7565R_addSprite						(ST7565R_Sprite* sprite, const uint8_t* bitmap, const uint8_t* mask, int x, int y, unsigned width, unsigned height);
+void ST7565R_removeSprite					(ST7565R_Sprite* sprite);
+void ST7565R_moveSprite						(ST7565R_Sprite* sprite, int x, int y);
+void ST7565R_setSpriteBitmap				(ST7565R_Sprite* sprite, const uint8_t* bitmap, const uint8_t* mask);
+void ST7565R_setSpriteMode					(ST7565R_Sprite* sprite, ST7565R_SpriteMode mode);
+void ST7565R_showSprite						(ST7565R_Sprite* sprite, bool visible);
+#endif
+
+#ifdef ST7565R_TILE_MAP
+// Tile Map Functions. Cells are 8 columns wide and one page (8 rows) high, column and row count cells from the top left of the
+// screen, ignoring the clip and viewport. Tiles are 8 bytes each, vertically oriented like bitmaps. Every cell starts as ST7565R_TILE_NONE,
+// which leaves it to the other paint functions. Don't paint inside cells that show a tile, which one ends up on top depends on the mode
+void ST7565R_setTileset						(const uint8_t* tiles, uint8_t count);
+void ST7565R_setTile						(unsigned column, unsigned row, uint8_t tile);
+void ST7565R_fillTiles						(unsigned column, unsigned row, unsigned columns, unsigned rows, uint8_t tile);
+uint8_t ST7565R_getTile						(unsigned column, unsigned row);
+void ST7565R_clearTiles						(void);
+#endif
+
+// Locking (for drawing from more than one task). The hooks must be a recursive mutex, e.g. xSemaphoreTakeRecursive()/
+// xSemaphoreGiveRecursive() on FreeRTOS or a PTHREAD_MUTEX_RECURSIVE pthread mutex. Hold the lock around everything one task draws,
+// clips and fonts are shared too. updateDisplay(), clearScreen() and widgetRender() take it themselves
+void ST7565R_setLockHooks					(ST7565R_LockHook lock, ST7565R_LockHook unlock, void* context);
+void ST7565R_lock							(void);
+void ST7565R_unlock							(void);
+
+#ifdef ST7565R_GRAYSCALE
+// Grayscale (ST7565R_GRAYSCALE). Levels go from 0 (white) to 3 (black), and anything the other paint functions draw shows black
+// over them. A gray bitmap is two ordinary vertically oriented bitmaps back to back: the levels' low bits, then their high bits
+void ST7565R_paintGrayPixel					(uint8_t level, unsigned x, unsigned y);
+void ST7565R_paintGrayRectangle				(uint8_t level, unsigned x, unsigned y, unsigned width, unsigned height);
+void ST7565R_paintGrayBitmap				(const uint8_t* bitmap, unsigned x, unsigned y, unsigned width, unsigned height);
+void ST7565R_grayscaleTick					(void);
+ST7565R_GrayStats ST7565R_getGrayStats		(void);
+#endif
+
+#ifdef ST7565R_TRACE
+// Wire trace (ST7565R_TRACE). The sink gets the trace a buffer at a time, write it to a file, a UART or RAM and replay it
+// with tools/tracereplay.c, whose header describes the format. Set the sink before ST7565R_setup() to catch the init commands
+void ST7565R_setTraceSink					(ST7565R_TraceSink sink, void* context);
+void ST7565R_traceFlush						(void);
+#endif
+
+// Number Functions (no printf needed). width is the minimum number of characters: padded on the left with pad (' ' or '0'),
+// or on the right with spaces when negative. Every character is numberCharWidth() wide, so columns of numbers line up
+void ST7565R_paintInt						(int32_t value, int x, int y, int8_t width, char pad);
+void ST7565R_paintFixed						(int32_t value, uint8_t decimals, int x, int y, int8_t width, char pad);
+unsigned ST7565R_numberCharWidth			(void);
 
 // Font Functions
 void ST7565R_configureFont					(ST7565R_Font newFont);
+ST7565R_Font ST7565R_getFont				(void);
 void ST7565R_configureFontDefault			(void);
 void ST7565R_configureFontFlow				(void);
+void ST7565R_configureFontProportional		(void);
 /* To use custom fonts, you will need to make and pass
  * your own font structure */ #pragma ST7565R_Font /*
+ * Fixed width fonts are horizontally oriented (rows of bytes, MSB is leftmost).
+ * Proportional fonts set glyphTable and store vertically oriented glyphs page by page,
+ * the same way bitmaps are stored. Make them with tools/fontconv.c
+ * Fonts with symbols outside firstChar to lastChar (like degree or micro signs) list
+ * their code points in a sorted ranges table, see fontCRCRanges in crcFont.h
  * */
- 
-// Private Functions
-static void ST7565R_paintCurScreen			(void);
-static void ST7565R_addCharToCurScreen		(char c, unsigned x, unsigned y);
-static void ST7565R_addPixelToCurScreen		(ST7565R_DrawState  drawOrErase, unsigned x, unsigned y);
 
-// Backlight functions
+#ifdef ST7565R_ASSET_PACK
+// Asset Packs (ST7565R_ASSET_PACK). A pack is a file of fonts and assets with an index, see tools/bmpconv.c. Open it mapped when it's
+// in memory, or with a read function for SPI flash or a file: read(offset, bytes, count, context) fills bytes and returns false on errors.
+// Entries are numbered in the order they were added, the converters write their numbers into a header. The pack structs are yours,
+// keep them alive while they're used and call packClose() if the pack behind one changes
+bool ST7565R_packOpen						(ST7565R_Pack* pack, ST7565R_PackRead read, void* context);
+bool ST7565R_packOpenMapped					(ST7565R_Pack* pack, const uint8_t* data, uint32_t size);
+void ST7565R_packClose						(const ST7565R_Pack* pack);
+bool ST7565R_packEntry						(const ST7565R_Pack* pack, unsigned index, ST7565R_PackEntry* entry);
+bool ST7565R_packAsset						(const ST7565R_Pack* pack, unsigned index, ST7565R_Asset* asset);	// Mapped packs only
+bool ST7565R_paintPackAsset					(const ST7565R_Pack* pack, unsigned index, unsigned frame, int x, int y);
+bool ST7565R_packFont						(const ST7565R_Pack* pack, unsigned index, ST7565R_PackFont* stream, ST7565R_Glyph* table, unsigned tableSize, ST7565R_Font* font);
+ST7565R_PackStats ST7565R_getPackStats		(void);
+#endif
+ 
+// Backlight functions (brightness is 0 - 100, gamma corrected). Effects run from ST7565R_backlightTick(), call it from a timer
+// interrupt ST7565R_BACKLIGHT_TICK_HZ times a second. Setting a brightness or starting an effect cancels the running effect
 void ST7565R_setBacklight					(uint8_t brightness);
-void ST7565R_blinkBacklight					(float oscillation);
+void ST7565R_fadeBacklight					(uint8_t brightness, uint16_t durationMs);
+void ST7565R_breatheBacklight				(uint8_t low, uint8_t high, uint16_t periodMs);
+void ST7565R_blinkBacklight					(uint8_t brightness, uint16_t onMs, uint16_t offMs);
+void ST7565R_setBacklightIdle				(uint16_t timeoutSeconds, uint8_t dimBrightness, ST7565R_IdlePolicy policy);
+void ST7565R_backlightActivity				(void);
+void ST7565R_backlightTick					(void);
 
 
 // Test Functions
 void ST7565R_screenTest						(void);
+#ifdef ST7565R_SELF_CHECK
+// Leaves the screen cleared and the clip reset. Strings use the current font. A failure comes back with the same seed and firstFailure + 1 rounds
+ST7565R_CheckStats ST7565R_selfCheck		(uint32_t rounds, uint32_t seed);
+#endif
 
 
 /*************************************************************************************************************************\
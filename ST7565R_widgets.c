@@ -0,0 +1,404 @@
+
+
+
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Retained widgets for the ST7565R driver. See ST7565R_widgets.h
+		Each widget remembers what it last painted. Setting a value only flags the widget when the value is really different,
+		and rendering paints just the flagged widgets inside their own viewport, which also marks only their area dirty.
+ ***********************************************************************************************************************************************************************
+ */
+
+/*****************************************************
+*		INCLUSIONS									 *
+*****************************************************/
+#include <string.h>
+
+#include "ST7565R_widgets.h"
+
+
+/*****************************************************
+*		PRIVATE FUNCTION PROTOTYPES					 *
+*****************************************************/
+static void ST7565R_widgetInit			(ST7565R_Widget* widget, ST7565R_WidgetType type, int x, int y, unsigned width, unsigned height);
+static void ST7565R_widgetRenderTree	(ST7565R_Widget* widget);
+static void ST7565R_widgetPaint			(ST7565R_Widget* widget);
+static void ST7565R_widgetPaintText		(ST7565R_Widget* widget, char* text);
+static void ST7565R_widgetPaintNumber	(ST7565R_Widget* widget);
+static uintptr_t ST7565R_widgetHashText	(const char* text);
+static void ST7565R_chartRebuild		(ST7565R_Chart* chart);
+static void ST7565R_chartScroll			(ST7565R_Chart* chart);
+static void ST7565R_chartColumn			(ST7565R_Chart* chart, unsigned column, int16_t low, int16_t high, bool join);
+static unsigned ST7565R_chartRow		(const ST7565R_Chart* chart, int16_t value);
+
+
+/*****************************************************
+*		SETUP										 *
+*****************************************************/
+void ST7565R_widgetInitPanel(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height)
+{	// A panel erases its area when first rendered, and its children are positioned inside it
+	ST7565R_widgetInit(widget, WIDGET_PANEL, x, y, width, height);
+}
+
+void ST7565R_widgetInitLabel(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, const char* text, ST7565R_Align align)
+{	// The text is word wrapped and aligned inside the label
+	ST7565R_widgetInit(widget, WIDGET_LABEL, x, y, width, height);
+	widget->align 		= align;
+	widget->value.text 	= text;
+}
+
+void ST7565R_widgetInitNumber(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, int32_t number, uint8_t decimals, ST7565R_Align align)
+{	// number is fixed point, e.g. 1234 with 2 decimals shows 12.34
+	ST7565R_widgetInit(widget, WIDGET_NUMBER, x, y, width, height);
+	widget->align 			= align;
+	widget->decimals 		= decimals;
+	widget->value.number 	= number;
+}
+
+void ST7565R_widgetInitBar(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, uint8_t percent)
+{	// An outlined progress bar, filled from the left
+	ST7565R_widgetInit(widget, WIDGET_BAR, x, y, width, height);
+	widget->value.percent = (percent > 100) ? 100 : percent;
+}
+
+void ST7565R_widgetInitIcon(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, const uint8_t* bitmap)
+{	// A vertically oriented bitmap the size of the widget
+	ST7565R_widgetInit(widget, WIDGET_ICON, x, y, width, height);
+	widget->value.bitmap = bitmap;
+}
+
+void ST7565R_widgetInitChart(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, ST7565R_Chart* chart, int16_t low, int16_t high)
+{	// A strip chart of the samples added to it, low at the bottom edge and high at the top. chart brings the buffers, see ST7565R_Chart
+	ST7565R_widgetInit(widget, WIDGET_CHART, x, y, width, height);
+	widget->value.chart = chart;
+	chart->width 		= width;
+	chart->height 		= height;
+	chart->low 			= low;
+	chart->high 		= high;
+	chart->perColumn 	= (chart->perColumn == 0) ? 1 : chart->perColumn;
+	chart->head 		= 0;
+	chart->count 		= 0;
+	chart->pending 		= 0;
+	chart->total 		= 0;
+	ST7565R_chartRebuild(chart);
+}
+
+void ST7565R_widgetAdd(ST7565R_Widget* parent, ST7565R_Widget* child)
+{	// Append a child to the end of the parent's children
+	if (parent == NULL || child == NULL) {return;}
+	child->next = NULL;
+	if (parent->firstChild == NULL)
+	{
+		parent->firstChild = child;
+		return;
+	}
+	ST7565R_Widget* last = parent->firstChild;
+	while (last->next != NULL) {last = last->next;}
+	last->next = child;
+}
+
+void ST7565R_widgetSetFont(ST7565R_Widget* widget, const ST7565R_Font* font)
+{	// Give a label or number its own font (NULL goes back to the current font)
+	widget->font = font;
+	widget->changed = true;
+}
+
+
+/*****************************************************
+*		VALUES										 *
+*****************************************************/
+void ST7565R_widgetSetText(ST7565R_Widget* widget, const char* text)
+{	// Call this again after changing the contents of the same buffer, the text is compared by hash
+	widget->value.text = text;
+	if (ST7565R_widgetHashText(text) != widget->shown) {widget->changed = true;}
+}
+
+void ST7565R_widgetSetNumber(ST7565R_Widget* widget, int32_t number)
+{
+	widget->value.number = number;
+	if ((uintptr_t)(uint32_t)number != widget->shown) {widget->changed = true;}
+}
+
+void ST7565R_widgetSetPercent(ST7565R_Widget* widget, uint8_t percent)
+{
+	widget->value.percent = (percent > 100) ? 100 : percent;
+	if (widget->value.percent != widget->shown) {widget->changed = true;}
+}
+
+void ST7565R_widgetSetBitmap(ST7565R_Widget* widget, const uint8_t* bitmap)
+{
+	widget->value.bitmap = bitmap;
+	if ((uintptr_t)bitmap != widget->shown) {widget->changed = true;}
+}
+
+
+void ST7565R_widgetAddSample(ST7565R_Widget* widget, int16_t sample)
+{	// Every perColumn samples finish a column: the plot scrolls left by one and the new column is drawn on the right, from the
+	// lowest to the highest of its samples and joined to the column before. Only then does the widget need painting
+	ST7565R_Chart* chart = widget->value.chart;
+	unsigned capacity = ST7565R_CHART_SAMPLES(chart->width, chart->perColumn);
+	chart->samples[chart->head] = sample;
+	chart->head = (chart->head + 1) % capacity;
+	if (chart->count < capacity) {chart->count++;}
+
+	if (chart->pending++ == 0)
+	{
+		chart->pendingLow 	= sample;
+		chart->pendingHigh 	= sample;
+	}
+	if (sample < chart->pendingLow) 	{chart->pendingLow = sample;}
+	if (sample > chart->pendingHigh) 	{chart->pendingHigh = sample;}
+	if (chart->pending < chart->perColumn) {return;}
+
+	bool join = chart->shown > 0;
+	ST7565R_chartScroll(chart);
+	ST7565R_chartColumn(chart, chart->width - 1, chart->pendingLow, chart->pendingHigh, join);
+	chart->last 	= sample;
+	chart->pending 	= 0;
+	chart->total++;
+	widget->changed = true;
+}
+
+void ST7565R_widgetSetRange(ST7565R_Widget* widget, int16_t low, int16_t high)
+{	// Rescale a chart, its columns are rebuilt from the samples it kept
+	ST7565R_Chart* chart = widget->value.chart;
+	if (low == chart->low && high == chart->high) {return;}
+	chart->low 		= low;
+	chart->high 	= high;
+	ST7565R_chartRebuild(chart);
+	widget->changed = true;
+}
+
+
+/*****************************************************
+*		RENDERING									 *
+*****************************************************/
+void ST7565R_widgetInvalidate(ST7565R_Widget* widget)
+{	// Force a widget and everything inside it to be painted on the next render
+	widget->changed = true;
+	for (ST7565R_Widget* child = widget->firstChild; child != NULL; child = child->next)
+	{
+		ST7565R_widgetInvalidate(child);
+	}
+}
+
+void ST7565R_widgetRender(ST7565R_Widget* root)
+{	// Paint every widget in the tree whose value changed since it was last painted. DON'T FORGET TO updateDisplay()
+	if (root == NULL) {return;}
+	ST7565R_lock();
+	ST7565R_widgetRenderTree(root);
+	ST7565R_unlock();
+}
+
+
+/*****************************************************
+*		FUNCTIONS NOT TO BE REFERENCED OUTSIDE		 *
+*****************************************************/
+static void ST7565R_widgetInit(ST7565R_Widget* widget, ST7565R_WidgetType type, int x, int y, unsigned width, unsigned height)
+{
+	memset(widget, 0, sizeof(ST7565R_Widget));
+	widget->type 	= type;
+	widget->x 		= x;
+	widget->y 		= y;
+	widget->width 	= width;
+	widget->height 	= height;
+	widget->changed = true;
+}
+
+static void ST7565R_widgetRenderTree(ST7565R_Widget* widget)
+{	// Each widget draws in its own viewport, so it can't spill outside its box and children are placed relative to it
+	if (!ST7565R_pushViewport(widget->x, widget->y, widget->width, widget->height))
+	{	// Nested deeper than ST7565R_CLIP_STACK_DEPTH, leave it flagged
+		return;
+	}
+
+	if (widget->changed)
+	{
+		ST7565R_widgetPaint(widget);
+		widget->changed = false;
+	}
+	for (ST7565R_Widget* child = widget->firstChild; child != NULL; child = child->next)
+	{
+		ST7565R_widgetRenderTree(child);
+	}
+	ST7565R_popClip();
+}
+
+static void ST7565R_widgetPaint(ST7565R_Widget* widget)
+{	// Repaint a widget's whole box, updateDisplay() works out which bytes actually changed
+	if (widget->type != WIDGET_NUMBER && widget->type != WIDGET_CHART)
+	{	// Numbers overwrite their own characters, erasing them would make paintFixed() repaint every digit. Charts cover their whole box
+		ST7565R_paintRectangle(ERASE, 0, 0, widget->width, widget->height);
+	}
+	switch (widget->type)
+	{
+	case WIDGET_PANEL:
+		for (ST7565R_Widget* child = widget->firstChild; child != NULL; child = child->next)
+		{	// The children were just erased too
+			ST7565R_widgetInvalidate(child);
+		}
+		break;
+
+	case WIDGET_LABEL:
+		ST7565R_widgetPaintText(widget, (char*)widget->value.text);
+		widget->shown = ST7565R_widgetHashText(widget->value.text);
+		break;
+
+	case WIDGET_NUMBER:
+		ST7565R_widgetPaintNumber(widget);
+		widget->shown = (uintptr_t)(uint32_t)widget->value.number;
+		break;
+
+	case WIDGET_BAR:
+	{
+		unsigned inner = (widget->width > 4) ? widget->width - 4 : 0;
+		ST7565R_paintRectangle(DRAW, 0, 0, widget->width, 1);						// Outline
+		ST7565R_paintRectangle(DRAW, 0, widget->height - 1, widget->width, 1);
+		ST7565R_paintRectangle(DRAW, 0, 0, 1, widget->height);
+		ST7565R_paintRectangle(DRAW, widget->width - 1, 0, 1, widget->height);
+		if (widget->height > 4)
+		{	// Fill, with a blank pixel between it and the outline
+			ST7565R_paintRectangle(DRAW, 2, 2, (inner * widget->value.percent) / 100, widget->height - 4);
+		}
+		widget->shown = widget->value.percent;
+		break;
+	}
+
+	case WIDGET_ICON:
+		if (widget->value.bitmap != NULL)
+		{
+			ST7565R_paintBitmap((uint8_t*)widget->value.bitmap, 0, 0, widget->width, widget->height);
+		}
+		widget->shown = (uintptr_t)widget->value.bitmap;
+		break;
+
+	case WIDGET_CHART:
+		// Already page bytes, so this is a straight copy into curScreen that marks just the plot dirty
+		ST7565R_paintBitmap(widget->value.chart->columns, 0, 0, widget->width, widget->height);
+		widget->shown = widget->value.chart->total;
+		break;
+	}
+}
+
+static void ST7565R_widgetPaintText(ST7565R_Widget* widget, char* text)
+{	// Paint text in the widget's font, then put the current font back
+	if (text == NULL) {return;}
+	if (widget->font == NULL)
+	{
+		ST7565R_paintStringBox(text, 0, 0, widget->width, widget->height, widget->align, true);
+		return;
+	}
+	ST7565R_Font saved = ST7565R_getFont();
+	ST7565R_configureFont(*widget->font);
+	ST7565R_paintStringBox(text, 0, 0, widget->width, widget->height, widget->align, true);
+	ST7565R_configureFont(saved);
+}
+
+static void ST7565R_widgetPaintNumber(ST7565R_Widget* widget)
+{	// Numbers fill as many fixed width characters as fit, padded with spaces, so the digits stay put as the value changes
+	ST7565R_Font saved = ST7565R_getFont();
+	if (widget->font != NULL) {ST7565R_configureFont(*widget->font);}
+
+	unsigned charWidth 	= ST7565R_numberCharWidth();
+	unsigned height 	= ST7565R_getFont().height;
+	unsigned chars 		= (charWidth == 0) ? 0 : widget->width / charWidth;
+	if (chars > ST7565R_NUMBER_MAX_CHARS) {chars = ST7565R_NUMBER_MAX_CHARS;}
+	unsigned used 		= chars * charWidth;
+	int x 				= 0;
+	int8_t width 		= -(int8_t)chars;					// Left aligned, padded on the right
+	if (widget->align == ALIGN_CENTER)		{x = (widget->width - used) / 2;	width = chars;}
+	else if (widget->align == ALIGN_RIGHT)	{x = widget->width - used;			width = chars;}
+
+	// Blank whatever the characters don't cover
+	ST7565R_paintRectangle(ERASE, 0, 0, x, widget->height);
+	ST7565R_paintRectangle(ERASE, x + used, 0, widget->width - x - used, widget->height);
+	if (widget->height > height) {ST7565R_paintRectangle(ERASE, x, height, used, widget->height - height);}
+
+	ST7565R_paintFixed(widget->value.number, widget->decimals, x, 0, width, ' ');
+	ST7565R_configureFont(saved);
+}
+
+static uintptr_t ST7565R_widgetHashText(const char* text)
+{	// FNV-1a, cheap enough to run on every setText()
+	uint32_t hash = 2166136261u;
+	if (text == NULL) {return 0;}
+	while (*text != '\0')
+	{
+		hash ^= (uint8_t)*text++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+static void ST7565R_chartRebuild(ST7565R_Chart* chart)
+{	// Redraw every column from the ring, newest on the right. The column still being gathered isn't shown yet
+	unsigned capacity 	= ST7565R_CHART_SAMPLES(chart->width, chart->perColumn);
+	unsigned finished 	= chart->count - chart->pending;					// Samples in finished columns, the oldest come first
+	unsigned columns 	= finished / chart->perColumn;
+	if (columns > chart->width) {columns = chart->width;}
+	memset(chart->columns, 0, ST7565R_CHART_BYTES(chart->width, chart->height));
+
+	unsigned next 	= (chart->head + (2 * capacity) - chart->pending - (columns * chart->perColumn)) % capacity;
+	bool join 		= columns * chart->perColumn < finished;				// The sample before the oldest column is still there
+	if (join) {chart->last = chart->samples[(next + capacity - 1) % capacity];}
+	for (unsigned column = chart->width - columns; column < chart->width; column++)
+	{
+		int16_t low 	= chart->samples[next];
+		int16_t high 	= low;
+		int16_t sample 	= low;
+		for (unsigned i = 0; i < chart->perColumn; i++)
+		{
+			sample = chart->samples[next];
+			if (sample < low) 	{low = sample;}
+			if (sample > high) 	{high = sample;}
+			next = (next + 1) % capacity;
+		}
+		ST7565R_chartColumn(chart, column, low, high, join);
+		chart->last = sample;
+		join = true;
+	}
+	chart->shown = columns;
+}
+
+static void ST7565R_chartScroll(ST7565R_Chart* chart)
+{	// Move every page row of the plot left a column, the rightmost one is left for the new column
+	for (unsigned page = 0; page * 8 < chart->height; page++)
+	{
+		uint8_t* row = &chart->columns[page * chart->width];
+		memmove(row, row + 1, chart->width - 1);
+	}
+	if (chart->shown < chart->width) {chart->shown++;}
+}
+
+static void ST7565R_chartColumn(ST7565R_Chart* chart, unsigned column, int16_t low, int16_t high, bool join)
+{	// Build one column's page bytes: a line from low to high, joined stretches it to reach chart->last so the trace has no gaps
+	if (join)
+	{
+		if (chart->last < low) 	{low = chart->last;}
+		if (chart->last > high) {high = chart->last;}
+	}
+	unsigned top 	= ST7565R_chartRow(chart, high);
+	unsigned bottom = ST7565R_chartRow(chart, low);
+	for (unsigned page = 0; page * 8 < chart->height; page++)
+	{
+		unsigned first 	= page * 8;
+		uint8_t bits 	= 0;
+		if (top < first + 8 && bottom >= first)
+		{	// Rows top to bottom of this page
+			unsigned from 	= (top > first) ? top - first : 0;
+			unsigned to 	= (bottom < first + 7) ? bottom - first : 7;
+			bits = (uint8_t)((0xFF << from) & (0xFF >> (7 - to)));
+		}
+		chart->columns[(page * chart->width) + column] = bits;
+	}
+}
+
+static unsigned ST7565R_chartRow(const ST7565R_Chart* chart, int16_t value)
+{	// Row of the plot a value lands on, 0 is the top (high)
+	if (chart->high <= chart->low || chart->height < 2) {return chart->height - 1;}
+	if (value >= chart->high) 	{return 0;}
+	if (value <= chart->low) 	{return chart->height - 1;}
+	int32_t span = (int32_t)chart->high - chart->low;
+	return (unsigned)((((int32_t)chart->high - value) * (chart->height - 1) + (span / 2)) / span);
+}
@@ -0,0 +1,113 @@
+
+
+
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		ST7565R_widgets.c | .h is a small retained widget layer on top of the driver's paint functions.
+		Build a tree of labels, numbers, bars and icons once, change their values whenever you like, and call
+		ST7565R_widgetRender() followed by ST7565R_updateDisplay(). Only widgets whose value actually changed get painted,
+		and updateDisplay() only sends the bytes they changed, so a fast changing readout costs a handful of bytes.
+
+		Uncomment RETAIN_CURSCREEN in ST7565R.h when using widgets. Otherwise updateDisplay() clears the screen
+		and you have to call ST7565R_widgetInvalidate() on the root before every render.
+ ***********************************************************************************************************************************************************************
+ */
+
+
+#ifndef ST7565R_WIDGETS_H
+#define ST7565R_WIDGETS_H
+
+/*****************************************************
+*		INCLUSIONS									 *
+*****************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ST7565R.h"
+
+/*****************************************************
+*		ENUMERATIONS AND STRUCTURES					 *
+*****************************************************/
+typedef enum{
+	WIDGET_PANEL,							// Groups children, they are positioned inside it
+	WIDGET_LABEL,
+	WIDGET_NUMBER,
+	WIDGET_BAR,
+	WIDGET_ICON,
+	WIDGET_CHART							// Scrolling history of samples, newest on the right
+} ST7565R_WidgetType;
+
+// Storage for a chart widget's history. Size the arrays with these and fill in samples, columns and perColumn, e.g.
+// static int16_t history[ST7565R_CHART_SAMPLES(100, 4)]; static uint8_t plot[ST7565R_CHART_BYTES(100, 24)];
+// static ST7565R_Chart chart = {.samples = history, .columns = plot, .perColumn = 4};
+#define ST7565R_CHART_SAMPLES(width, perColumn)		(((width) + 1) * (perColumn))
+#define ST7565R_CHART_BYTES(width, height)			((width) * (((height) + 7) / 8))
+
+typedef struct ST7565R_Chart_Struct{
+	int16_t* samples;						// Ring of the latest samples, ST7565R_CHART_SAMPLES()
+	uint8_t* columns;						// The plot as page bytes, a page row after another, ST7565R_CHART_BYTES()
+	uint16_t perColumn;						// Samples folded into each column as a min/max line, 1 scrolls a column per sample
+	uint8_t width;							// Set by ST7565R_widgetInitChart() from here on
+	uint8_t height;
+	int16_t low;							// Values at the bottom and top edges, anything outside is clamped
+	int16_t high;
+	uint16_t head;							// Slot of the next sample
+	uint16_t count;							// Samples in the ring
+	uint16_t pending;						// Samples of the column still being gathered
+	int16_t pendingLow;						// Their envelope
+	int16_t pendingHigh;
+	int16_t last;							// Latest sample of the newest column, the next column is joined to it
+	uint16_t shown;							// Columns with data, counted from the right
+	uint32_t total;							// Columns ever finished, what the widget compares to repaint
+} ST7565R_Chart;
+
+typedef struct ST7565R_Widget_Struct{
+	ST7565R_WidgetType type;
+	int16_t x;								// Position inside the parent
+	int16_t y;
+	uint8_t width;
+	uint8_t height;
+	ST7565R_Align align;					// Labels and numbers
+	uint8_t decimals;						// Numbers: digits after the decimal point
+	bool changed;							// Gets painted on the next render
+	const ST7565R_Font* font;				// Labels and numbers, NULL uses the current font
+	union {
+		const char* text;					// Labels
+		int32_t number;						// Numbers, scaled by 10^decimals
+		uint8_t percent;					// Bars
+		const uint8_t* bitmap;				// Icons
+		ST7565R_Chart* chart;				// Charts
+	} value;
+	uintptr_t shown;						// What was painted last: text hash, number, percent, bitmap address or columns finished
+	struct ST7565R_Widget_Struct* firstChild;
+	struct ST7565R_Widget_Struct* next;		// Next sibling
+} ST7565R_Widget;
+
+/*****************************************************
+*		FUNCTION PROTOTYPES							 *
+*****************************************************/
+
+/*	SETUP  */
+void ST7565R_widgetInitPanel			(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height);
+void ST7565R_widgetInitLabel			(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, const char* text, ST7565R_Align align);
+void ST7565R_widgetInitNumber			(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, int32_t number, uint8_t decimals, ST7565R_Align align);
+void ST7565R_widgetInitBar				(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, uint8_t percent);
+void ST7565R_widgetInitIcon				(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, const uint8_t* bitmap);
+void ST7565R_widgetInitChart			(ST7565R_Widget* widget, int x, int y, unsigned width, unsigned height, ST7565R_Chart* chart, int16_t low, int16_t high);
+void ST7565R_widgetAdd					(ST7565R_Widget* parent, ST7565R_Widget* child);
+void ST7565R_widgetSetFont				(ST7565R_Widget* widget, const ST7565R_Font* font);
+
+/*	VALUES  */
+void ST7565R_widgetSetText				(ST7565R_Widget* widget, const char* text);
+void ST7565R_widgetSetNumber			(ST7565R_Widget* widget, int32_t number);
+void ST7565R_widgetSetPercent			(ST7565R_Widget* widget, uint8_t percent);
+void ST7565R_widgetSetBitmap			(ST7565R_Widget* widget, const uint8_t* bitmap);
+void ST7565R_widgetAddSample			(ST7565R_Widget* widget, int16_t sample);
+void ST7565R_widgetSetRange				(ST7565R_Widget* widget, int16_t low, int16_t high);
+
+/*	RENDERING  */
+void ST7565R_widgetInvalidate			(ST7565R_Widget* widget);
+void ST7565R_widgetRender				(ST7565R_Widget* root);
+
+
+#endif
@@ -1,44 +1,18 @@
 
-
-
-
-
-
-
-
 /*
- ***********************************************************************************************************************************************************************
-	Author:		Mason Reck
- ***********************************************************************************************************************************************************************
-	Description:
-        bitmaps.c | .h will store all the necessary data for bitmaps and animations for our display.
-        Data will be stored within functions, simply call the function to retrieve your wanted bitmap.
-***********************************************************************************************************************************************************************
+ * bitmaps.h
+ *
+ * Generated by tools/bmpconv.c. Do not edit by hand, change the images and re-run the converter instead.
+ * Paint an asset with ST7565R_paintAsset(&asset_<name>, frame, x, y).
  */
 
-
 #ifndef BITMAPS_H
 #define BITMAPS_H
 
-/*****************************************************
-*		INCLUSIONS									 *
-*****************************************************/
-#include <stdint.h>
-
-/*****************************************************
-*		FUNCTION PROTOTYPES							 *
-*****************************************************/
-
-
-/*	BITMAPS	 */
-uint8_t* bmp_clear();
-uint8_t* bmp_crcLeft();
-uint8_t* bmp_crcSmall();
-
-
-/*	ANIMATIONS  */
-uint8_t** anim_intro();
-
+#include "ST7565R.h"
 
-#endif
+extern const ST7565R_Asset asset_crcLeft;		// 128x32, 1 frame
+extern const ST7565R_Asset asset_crcSmall;		// 17x8, 1 frame
+extern const ST7565R_Asset asset_intro;		// 128x32, 7 frames
 
+#endif /* BITMAPS_H */
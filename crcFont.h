@@ -23,10 +23,11 @@
 /** First character defined. */
 #define CRCFONT_FIRSTCHAR			((uint8_t)' ')
 /** Last character defined. */
-#define CRCFONT_LASTCHAR			((uint8_t)'}')
+#define CRCFONT_LASTCHAR			((uint8_t)'~')
 
 
-/* Glyph data, row by row, MSB is leftmost pixel, two bytes per row. */
+/* Glyph data, row by row, MSB is leftmost pixel, two bytes per row.
+ * ASCII glyphs come first, symbols reached through fontCRCRanges follow '~'. */
 static uint8_t fontCRC [] = {
 	0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,           /* " " */
 	0x4,  0x0,  0xe,  0x0,  0xe,  0x0,  0xe,  0x0,  0xe,  0x0,  0xe,  0x0,  0xe,  0x0,  0xe,  0x0,  0x4,  0x0,  0x0,  0x0,  0x0,  0x0,  0x4,  0x0,  0xe,  0x0,  0xe,  0x0,  0x4,  0x4,         /* "!" */
@@ -122,6 +123,23 @@ static uint8_t fontCRC [] = {
 	0x7,  0x0,  0xe,  0x0, 0x1c,  0x0, 0x18,  0x0, 0x18,  0x0, 0x18,  0x0, 0x38,  0x0, 0x60,  0x0, 0x38,  0x0, 0x18,  0x0, 0x18,  0x0, 0x18,  0x0, 0x1c,  0x0,  0xe,  0x0,  0x7,  0x0,        /* "{" */
 	0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,  0xc,  0x0,        /* "|" */
 	0x38,  0x0, 0x1c,  0x0,  0xe,  0x0,  0x6,  0x0,  0x6,  0x0,  0x6,  0x0,  0x3,  0x0,  0x1, 0x80,  0x3,  0x0,  0x6,  0x0,  0x6,  0x0,  0x6,  0x0,  0xe,  0x0, 0x1c,  0x0, 0x38,  0x0,        /* "}" */
+	0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0, 0x38, 0x80, 0x6d, 0x80, 0x47,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,         /* "~" */
+	0x1c,  0x0, 0x36,  0x0, 0x22,  0x0, 0x36,  0x0, 0x1c,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,         /* U+00B0 degree */
+	0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x71, 0xc0, 0x7f, 0xc0, 0x7b, 0xc0, 0x60,  0x0, 0x60,  0x0, 0x60,  0x0,         /* U+00B5 micro */
+	0x1f,  0x0, 0x3f, 0x80, 0x71, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x71, 0xc0, 0x3b, 0x80, 0x1b,  0x0, 0x1b,  0x0, 0x1b,  0x0, 0x71, 0xc0, 0x71, 0xc0,         /* U+03A9 omega */
+};
+
+/** Index of the glyph painted for characters the font doesn't have ('?'). */
+#define CRCFONT_FALLBACK_GLYPH		('?' - CRCFONT_FIRSTCHAR)
+/** Number of entries in fontCRCRanges. */
+#define CRCFONT_NUMRANGES			4
+
+/* Code points covered by fontCRC, sorted by code point. glyph is the index of each range's first glyph. */
+static const ST7565R_GlyphRange fontCRCRanges [] = {
+	{ .first = ' ',		.last = '~',	.glyph = 0 },		/* Printable ASCII */
+	{ .first = 0x00B0,	.last = 0x00B0,	.glyph = 95 },		/* Degree sign */
+	{ .first = 0x00B5,	.last = 0x00B5,	.glyph = 96 },		/* Micro sign */
+	{ .first = 0x03A9,	.last = 0x03A9,	.glyph = 97 },		/* Greek capital omega */
 };
 
 #endif
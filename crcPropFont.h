@@ -0,0 +1,234 @@
+
+/*
+ * crcPropFont.h
+ *
+ * Generated by tools/fontconv.c from crcFont.h. Do not edit by hand, re-run the converter instead.
+ * Glyphs are vertically oriented (LSB is the top pixel), page by page, like the driver's bitmaps.
+ */
+
+#ifndef CRCPROPFONT_H
+#define CRCPROPFONT_H
+
+#include <stdint.h>
+
+#define USING_FONT_CRC_PROP
+
+#if defined(USING_FONT_CRC_PROP)
+/** Height of each glyph bitmap. */
+#define CRCPROPFONT_HEIGHT			15
+/** Rows above the baseline. */
+#define CRCPROPFONT_ASCENT			15
+/** Rows below the baseline. */
+#define CRCPROPFONT_DESCENT			0
+/** Widest advance of any glyph. */
+#define CRCPROPFONT_MAXADVANCE		10
+/** First character defined. */
+#define CRCPROPFONT_FIRSTCHAR		((uint8_t)32)
+/** Last character defined. */
+#define CRCPROPFONT_LASTCHAR		((uint8_t)126)
+
+/* Packed glyph data, 1550 bytes. Each glyph is <width> columns by 2 pages. */
+static const uint8_t fontCRCPropBitmaps[] = {
+	0xfe, 0xff, 0xfe, 0x30, 0x79, 0x30, 	/* "!" */
+	0x10, 0x0e, 0x06, 0x00, 0x00, 0x10, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 	/* """ */
+	0x20, 0x30, 0xfc, 0xfe, 0x30, 0xfc, 0xfe, 0x30, 0x10, 0x04, 0x06, 0x3f, 0x1f, 0x06, 0x3f, 0x1f, 0x06, 0x02, 	/* "#" */
+	0x30, 0x48, 0x84, 0xfe, 0x84, 0xfe, 0x84, 0x08, 0x10, 0x04, 0x08, 0x10, 0x3f, 0x10, 0x3f, 0x10, 0x09, 0x06, 	/* "$" */
+	0x18, 0x24, 0x24, 0x98, 0xc0, 0xe0, 0x70, 0x38, 0x18, 0x0c, 0x0e, 0x07, 0x03, 0x01, 0x0c, 0x12, 0x12, 0x0c, 	/* "%" */
+	0x1c, 0x3e, 0xe3, 0xc1, 0x63, 0x3e, 0x1c, 0x00, 0x00, 0x3e, 0x7f, 0x61, 0x61, 0x63, 0x3e, 0x38, 0x2c, 0x06, 	/* "&" */
+	0x0e, 0x16, 0x00, 0x00, 	/* "'" */
+	0xf8, 0xfc, 0x06, 0x03, 0x01, 0x0f, 0x1f, 0x30, 0x60, 0x40, 	/* "(" */
+	0x01, 0x03, 0x06, 0xfc, 0xf8, 0x40, 0x60, 0x30, 0x1f, 0x0f, 	/* ")" */
+	0x12, 0x0c, 0x3f, 0x0c, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 	/* "*" */
+	0x80, 0x80, 0x80, 0xf0, 0xf0, 0x80, 0x80, 0x80, 0x01, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 	/* "+" */
+	0x00, 0x00, 0x58, 0x38, 	/* "," */
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 	/* "-" */
+	0x00, 0x00, 0x30, 0x30, 	/* "." */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x70, 0x1c, 0x0e, 0x60, 0x38, 0x1c, 0x07, 0x03, 0x00, 0x00, 0x00, 0x40, 	/* "/" */
+	0xfe, 0xff, 0x07, 0x03, 0x83, 0x43, 0x27, 0xff, 0xfe, 0x3f, 0x7f, 0x72, 0x61, 0x60, 0x60, 0x70, 0x7f, 0x3f, 	/* "0" */
+	0x00, 0x08, 0x0c, 0x06, 0xff, 0xff, 0x00, 0x00, 0x00, 0x40, 0x60, 0x60, 0x60, 0x7f, 0x7f, 0x60, 0x60, 0x40, 	/* "1" */
+	0x1c, 0x0e, 0x03, 0x03, 0x83, 0xc3, 0x63, 0x3e, 0x1c, 0x38, 0x7c, 0x66, 0x63, 0x61, 0x60, 0x60, 0x60, 0x20, 	/* "2" */
+	0x02, 0x03, 0x83, 0xc3, 0xc3, 0xc3, 0xe7, 0x7e, 0x3c, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x71, 0x3f, 0x1e, 	/* "3" */
+	0xfe, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xff, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x7f, 	/* "4" */
+	0x7f, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x83, 0x01, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x71, 0x3f, 0x1f, 	/* "5" */
+	0xf8, 0xfe, 0x86, 0xc3, 0xc3, 0xc3, 0xc3, 0x86, 0x04, 0x1f, 0x3f, 0x71, 0x60, 0x60, 0x60, 0x71, 0x3f, 0x1f, 	/* "6" */
+	0x02, 0x03, 0x03, 0x03, 0x03, 0xc3, 0xe3, 0x3f, 0x1e, 0x40, 0x70, 0x38, 0x0e, 0x07, 0x01, 0x00, 0x00, 0x00, 	/* "7" */
+	0x1c, 0xbe, 0xf7, 0xe3, 0x43, 0xe3, 0xf7, 0xbe, 0x1c, 0x3f, 0x7f, 0x71, 0x60, 0x60, 0x60, 0x71, 0x7f, 0x3f, 	/* "8" */
+	0x3e, 0x7f, 0xe7, 0xc3, 0xc3, 0xc3, 0xe7, 0xff, 0xfe, 0x38, 0x78, 0x70, 0x60, 0x60, 0x60, 0x70, 0x7f, 0x3f, 	/* "9" */
+	0x38, 0x38, 0x0e, 0x0e, 	/* ":" */
+	0x38, 0x38, 0x16, 0x0e, 	/* ";" */
+	0x80, 0xc0, 0xe0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x08, 0x00, 0x01, 0x03, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x08, 	/* "<" */
+	0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 	/* "=" */
+	0x08, 0x18, 0x18, 0x30, 0x30, 0x60, 0xe0, 0xc0, 0x80, 0x08, 0x0c, 0x0c, 0x06, 0x06, 0x03, 0x03, 0x01, 0x00, 	/* ">" */
+	0x1c, 0x3e, 0x27, 0x03, 0x03, 0x83, 0xc7, 0xfe, 0x7c, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x03, 0x01, 0x00, 0x00, 	/* "?" */
+	0xfe, 0xff, 0x03, 0xf3, 0x13, 0xf3, 0x03, 0xff, 0xfe, 0x3f, 0x7f, 0x60, 0x63, 0x62, 0x67, 0x64, 0x73, 0x39, 	/* "@" */
+	0xf0, 0xfc, 0x1e, 0x07, 0x03, 0x87, 0x9e, 0xfc, 0xf0, 0x7f, 0x7f, 0x06, 0x06, 0x03, 0x01, 0x01, 0x7f, 0x7f, 	/* "A" */
+	0xfc, 0xfe, 0xc7, 0x83, 0xc3, 0xe7, 0x7e, 0x3c, 0x00, 0x3f, 0x7f, 0x70, 0x61, 0x61, 0x63, 0x77, 0x7e, 0x3c, 	/* "B" */
+	0xfc, 0xfe, 0x1f, 0x07, 0x03, 0x07, 0x0f, 0x1e, 0x1c, 0x1f, 0x3f, 0x7c, 0x70, 0x60, 0x70, 0x78, 0x3c, 0x1c, 	/* "C" */
+	0xff, 0xff, 0x03, 0x03, 0x03, 0x07, 0x0f, 0xfe, 0xfc, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x70, 0x78, 0x3f, 0x1f, 	/* "D" */
+	0x3c, 0xfe, 0xe7, 0xc3, 0xc3, 0xc3, 0x87, 0x0e, 0x0c, 0x1f, 0x3f, 0x79, 0x70, 0x60, 0x60, 0x70, 0x78, 0x38, 	/* "E" */
+	0xfe, 0xff, 0xc7, 0xc3, 0xc3, 0xc3, 0x83, 0x03, 0x02, 0x3f, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 	/* "F" */
+	0xfc, 0xfe, 0x07, 0x03, 0x03, 0x83, 0x87, 0x8e, 0x0c, 0x1f, 0x3f, 0x7c, 0x70, 0x63, 0x61, 0x73, 0x7f, 0x3f, 	/* "G" */
+	0xfe, 0xff, 0xe0, 0xc0, 0xc0, 0xc0, 0xe0, 0xff, 0xfe, 0x3f, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x7f, 0x3f, 	/* "H" */
+	0x02, 0x03, 0x03, 0xff, 0xff, 0xff, 0x03, 0x03, 0x02, 0x20, 0x60, 0x60, 0x7f, 0x7f, 0x7f, 0x60, 0x60, 0x20, 	/* "I" */
+	0x00, 0x00, 0x02, 0x03, 0xff, 0xff, 0xff, 0x03, 0x02, 0x38, 0x7c, 0x64, 0x60, 0x7f, 0x7f, 0x3f, 0x00, 0x00, 	/* "J" */
+	0xfe, 0xff, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0x3f, 0x1e, 0x3f, 0x7f, 0x00, 0x00, 0x00, 0x01, 0x03, 0x7f, 0x3e, 	/* "K" */
+	0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x20, 	/* "L" */
+	0xfe, 0xff, 0x07, 0x0e, 0xfc, 0x0e, 0x07, 0xff, 0xfe, 0x7f, 0x7f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x7f, 0x7f, 	/* "M" */
+	0xfe, 0xff, 0x0e, 0x07, 0x03, 0x03, 0x07, 0xfe, 0xfc, 0x3f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3f, 	/* "N" */
+	0xfc, 0xfe, 0x0f, 0x07, 0x03, 0x07, 0x0f, 0xfe, 0xfc, 0x1f, 0x3f, 0x78, 0x70, 0x60, 0x70, 0x78, 0x3f, 0x1f, 	/* "O" */
+	0xfc, 0xfe, 0xc7, 0x83, 0x83, 0x83, 0xc7, 0xfe, 0x7c, 0x3f, 0x7f, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 	/* "P" */
+	0xfc, 0xfe, 0x07, 0x03, 0x03, 0x03, 0x07, 0xfe, 0xfc, 0x07, 0x0f, 0x1c, 0x18, 0x30, 0x78, 0x7c, 0x4f, 0x47, 	/* "Q" */
+	0xfc, 0xfe, 0xc6, 0x83, 0x83, 0x83, 0xc7, 0x7e, 0x3c, 0x3f, 0x7f, 0x00, 0x01, 0x01, 0x03, 0x07, 0x7e, 0x3c, 	/* "R" */
+	0x3c, 0x7e, 0xe7, 0xc3, 0xc3, 0xc3, 0xc7, 0x8e, 0x0c, 0x1c, 0x3c, 0x70, 0x60, 0x60, 0x60, 0x71, 0x3f, 0x1f, 	/* "S" */
+	0x02, 0x03, 0x03, 0xff, 0xff, 0xff, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x3f, 0x00, 0x00, 0x00, 	/* "T" */
+	0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x3f, 0x7f, 0x60, 0x60, 0x70, 0x38, 0x1c, 0x7f, 0x3f, 	/* "U" */
+	0x7e, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x7e, 0x00, 0x03, 0x0f, 0x3e, 0x78, 0x3e, 0x0f, 0x03, 0x00, 	/* "V" */
+	0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x1f, 0x3f, 0x60, 0x3c, 0x1f, 0x3c, 0x60, 0x3f, 0x1f, 	/* "W" */
+	0x1e, 0x3f, 0x78, 0xe0, 0xc0, 0xe0, 0x78, 0x3f, 0x1e, 0x3c, 0x7e, 0x0f, 0x03, 0x01, 0x03, 0x0f, 0x7e, 0x3c, 	/* "X" */
+	0x1e, 0x3f, 0x78, 0xe0, 0xc0, 0xe0, 0x78, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x3f, 0x00, 0x00, 0x00, 	/* "Y" */
+	0x02, 0x03, 0x03, 0x83, 0xc3, 0xe3, 0x73, 0x3f, 0x1e, 0x3c, 0x7e, 0x67, 0x63, 0x61, 0x60, 0x60, 0x60, 0x20, 	/* "Z" */
+	0xff, 0xff, 0x03, 0x01, 0x7f, 0x7f, 0x60, 0x40, 	/* "[" */
+	0x0e, 0x1c, 0x70, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1c, 0x38, 0x60, 	/* "\" */
+	0x20, 0x78, 0x1e, 0x07, 0x1e, 0x78, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 	/* "]" */
+	0x20, 0x78, 0x1e, 0x07, 0x1e, 0x78, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 	/* "^" */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 	/* "_" */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 	/* "`" */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0x1f, 0x3f, 0x71, 0x60, 0x60, 0x60, 0x31, 0x7f, 0x7f, 	/* "a" */
+	0xfe, 0xff, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x7f, 0x7f, 0x31, 0x60, 0x60, 0x60, 0x71, 0x3f, 0x1f, 	/* "b" */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x1f, 0x3f, 0x71, 0x60, 0x60, 0x60, 0x60, 0x71, 0x31, 	/* "c" */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xff, 0xfe, 0x1f, 0x3f, 0x71, 0x60, 0x60, 0x60, 0x31, 0x7f, 0x7f, 	/* "d" */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x1f, 0x3f, 0x75, 0x64, 0x64, 0x64, 0x65, 0x37, 0x17, 	/* "e" */
+	0x00, 0x80, 0xf8, 0xfc, 0x8e, 0x86, 0x86, 0x0e, 0x0c, 0x01, 0x01, 0x3f, 0x7f, 0x01, 0x01, 0x00, 0x00, 0x00, 	/* "f" */
+	0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x23, 0x77, 0x56, 0x54, 0x54, 0x54, 0x76, 0x33, 0x1f, 	/* "g" */
+	0xfe, 0xff, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3f, 0x7f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x3e, 	/* "h" */
+	0x86, 0xcf, 0x86, 0x3f, 0x7f, 0x3f, 	/* "i" */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcf, 0x86, 0x18, 0x3c, 0x70, 0x60, 0x60, 0x70, 0x3f, 0x1f, 	/* "j" */
+	0xfe, 0xff, 0x80, 0x80, 0xc0, 0xc0, 0x60, 0x30, 0x18, 0x3f, 0x7f, 0x03, 0x01, 0x00, 0x01, 0x0f, 0x7e, 0x30, 	/* "k" */
+	0xfe, 0xff, 0x3f, 0x7f, 	/* "l" */
+	0xc0, 0x80, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0x80, 0x00, 0x3f, 0x7f, 0x01, 0x00, 0x07, 0x00, 0x01, 0x7f, 0x3f, 	/* "m" */
+	0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x3f, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x7f, 0x3f, 	/* "n" */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x1f, 0x3f, 0x71, 0x60, 0x60, 0x60, 0x71, 0x3f, 0x1f, 	/* "o" */
+	0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x3f, 0x7f, 0x06, 0x04, 0x04, 0x04, 0x06, 0x03, 0x03, 	/* "p" */
+	0x80, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0x80, 0x03, 0x07, 0x06, 0x04, 0x04, 0x04, 0x06, 0x7f, 0x3f, 	/* "q" */
+	0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x7f, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x03, 	/* "r" */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x27, 0x6f, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x7d, 0x39, 	/* "s" */
+	0x40, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x60, 0x20, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x00, 0x00, 0x00, 	/* "t" */
+	0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x1f, 0x3f, 0x70, 0x60, 0x60, 0x60, 0x30, 0x7f, 0x7f, 	/* "u" */
+	0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x03, 0x0f, 0x1e, 0x38, 0x60, 0x38, 0x1e, 0x0f, 0x03, 	/* "v" */
+	0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x3f, 0x7f, 0x60, 0x70, 0x3e, 0x70, 0x60, 0x7f, 0x3f, 	/* "w" */
+	0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x61, 0x33, 0x1e, 0x0c, 0x1e, 0x33, 0x61, 0x40, 	/* "x" */
+	0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x31, 0x63, 0x67, 0x66, 0x66, 0x66, 0x66, 0x3f, 0x1f, 	/* "y" */
+	0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x30, 0x78, 0x78, 0x6c, 0x6c, 0x66, 0x67, 0x63, 0x21, 	/* "z" */
+	0x80, 0xc0, 0x7c, 0x7e, 0x07, 0x03, 0x01, 0x00, 0x01, 0x1f, 0x3f, 0x70, 0x60, 0x40, 	/* "{" */
+	0xff, 0xff, 0x7f, 0x7f, 	/* "|" */
+	0x01, 0x03, 0x07, 0x3e, 0x7c, 0xc0, 0x80, 0x40, 0x60, 0x70, 0x3e, 0x1f, 0x01, 0x00, 	/* "}" */
+	0x80, 0xc0, 0x40, 0xc0, 0x80, 0x00, 0x80, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 	/* "~" */
+	0x0e, 0x1b, 0x11, 0x1b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 	/* Glyph 95 */
+	0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x7f, 0x7f, 0x0e, 0x0c, 0x04, 0x0c, 0x0e, 0x0f, 0x0f, 	/* Glyph 96 */
+	0xfc, 0xfe, 0x07, 0x03, 0x03, 0x03, 0x07, 0xfe, 0xfc, 0x61, 0x63, 0x7f, 0x1e, 0x00, 0x1e, 0x7f, 0x63, 0x61, 	/* Glyph 97 */
+};
+
+/* Per-glyph offset into fontCRCPropBitmaps, bitmap width and advance. */
+static const ST7565R_Glyph fontCRCPropGlyphs[] = {
+	{ .offset =    0, .width =  0, .advance =  5 },	/* " " */
+	{ .offset =    0, .width =  3, .advance =  4 },	/* "!" */
+	{ .offset =    6, .width =  8, .advance =  9 },	/* """ */
+	{ .offset =   22, .width =  9, .advance = 10 },	/* "#" */
+	{ .offset =   40, .width =  9, .advance = 10 },	/* "$" */
+	{ .offset =   58, .width =  9, .advance = 10 },	/* "%" */
+	{ .offset =   76, .width =  9, .advance = 10 },	/* "&" */
+	{ .offset =   94, .width =  2, .advance =  3 },	/* "'" */
+	{ .offset =   98, .width =  5, .advance =  6 },	/* "(" */
+	{ .offset =  108, .width =  5, .advance =  6 },	/* ")" */
+	{ .offset =  118, .width =  5, .advance =  6 },	/* "*" */
+	{ .offset =  128, .width =  8, .advance =  9 },	/* "+" */
+	{ .offset =  144, .width =  2, .advance =  3 },	/* "," */
+	{ .offset =  148, .width =  8, .advance =  9 },	/* "-" */
+	{ .offset =  164, .width =  2, .advance =  3 },	/* "." */
+	{ .offset =  168, .width =  9, .advance = 10 },	/* "/" */
+	{ .offset =  186, .width =  9, .advance = 10 },	/* "0" */
+	{ .offset =  204, .width =  9, .advance = 10 },	/* "1" */
+	{ .offset =  222, .width =  9, .advance = 10 },	/* "2" */
+	{ .offset =  240, .width =  9, .advance = 10 },	/* "3" */
+	{ .offset =  258, .width =  9, .advance = 10 },	/* "4" */
+	{ .offset =  276, .width =  9, .advance = 10 },	/* "5" */
+	{ .offset =  294, .width =  9, .advance = 10 },	/* "6" */
+	{ .offset =  312, .width =  9, .advance = 10 },	/* "7" */
+	{ .offset =  330, .width =  9, .advance = 10 },	/* "8" */
+	{ .offset =  348, .width =  9, .advance = 10 },	/* "9" */
+	{ .offset =  366, .width =  2, .advance =  3 },	/* ":" */
+	{ .offset =  370, .width =  2, .advance =  3 },	/* ";" */
+	{ .offset =  374, .width =  9, .advance = 10 },	/* "<" */
+	{ .offset =  392, .width =  9, .advance = 10 },	/* "=" */
+	{ .offset =  410, .width =  9, .advance = 10 },	/* ">" */
+	{ .offset =  428, .width =  9, .advance = 10 },	/* "?" */
+	{ .offset =  446, .width =  9, .advance = 10 },	/* "@" */
+	{ .offset =  464, .width =  9, .advance = 10 },	/* "A" */
+	{ .offset =  482, .width =  9, .advance = 10 },	/* "B" */
+	{ .offset =  500, .width =  9, .advance = 10 },	/* "C" */
+	{ .offset =  518, .width =  9, .advance = 10 },	/* "D" */
+	{ .offset =  536, .width =  9, .advance = 10 },	/* "E" */
+	{ .offset =  554, .width =  9, .advance = 10 },	/* "F" */
+	{ .offset =  572, .width =  9, .advance = 10 },	/* "G" */
+	{ .offset =  590, .width =  9, .advance = 10 },	/* "H" */
+	{ .offset =  608, .width =  9, .advance = 10 },	/* "I" */
+	{ .offset =  626, .width =  9, .advance = 10 },	/* "J" */
+	{ .offset =  644, .width =  9, .advance = 10 },	/* "K" */
+	{ .offset =  662, .width =  9, .advance = 10 },	/* "L" */
+	{ .offset =  680, .width =  9, .advance = 10 },	/* "M" */
+	{ .offset =  698, .width =  9, .advance = 10 },	/* "N" */
+	{ .offset =  716, .width =  9, .advance = 10 },	/* "O" */
+	{ .offset =  734, .width =  9, .advance = 10 },	/* "P" */
+	{ .offset =  752, .width =  9, .advance = 10 },	/* "Q" */
+	{ .offset =  770, .width =  9, .advance = 10 },	/* "R" */
+	{ .offset =  788, .width =  9, .advance = 10 },	/* "S" */
+	{ .offset =  806, .width =  9, .advance = 10 },	/* "T" */
+	{ .offset =  824, .width =  9, .advance = 10 },	/* "U" */
+	{ .offset =  842, .width =  9, .advance = 10 },	/* "V" */
+	{ .offset =  860, .width =  9, .advance = 10 },	/* "W" */
+	{ .offset =  878, .width =  9, .advance = 10 },	/* "X" */
+	{ .offset =  896, .width =  9, .advance = 10 },	/* "Y" */
+	{ .offset =  914, .width =  9, .advance = 10 },	/* "Z" */
+	{ .offset =  932, .width =  4, .advance =  5 },	/* "[" */
+	{ .offset =  940, .width =  9, .advance = 10 },	/* "\" */
+	{ .offset =  958, .width =  7, .advance =  8 },	/* "]" */
+	{ .offset =  972, .width =  7, .advance =  8 },	/* "^" */
+	{ .offset =  986, .width =  9, .advance = 10 },	/* "_" */
+	{ .offset = 1004, .width =  7, .advance =  8 },	/* "`" */
+	{ .offset = 1018, .width =  9, .advance = 10 },	/* "a" */
+	{ .offset = 1036, .width =  9, .advance = 10 },	/* "b" */
+	{ .offset = 1054, .width =  9, .advance = 10 },	/* "c" */
+	{ .offset = 1072, .width =  9, .advance = 10 },	/* "d" */
+	{ .offset = 1090, .width =  9, .advance = 10 },	/* "e" */
+	{ .offset = 1108, .width =  9, .advance = 10 },	/* "f" */
+	{ .offset = 1126, .width =  9, .advance = 10 },	/* "g" */
+	{ .offset = 1144, .width =  9, .advance = 10 },	/* "h" */
+	{ .offset = 1162, .width =  3, .advance =  4 },	/* "i" */
+	{ .offset = 1168, .width =  8, .advance =  9 },	/* "j" */
+	{ .offset = 1184, .width =  9, .advance = 10 },	/* "k" */
+	{ .offset = 1202, .width =  2, .advance =  3 },	/* "l" */
+	{ .offset = 1206, .width =  9, .advance = 10 },	/* "m" */
+	{ .offset = 1224, .width =  9, .advance = 10 },	/* "n" */
+	{ .offset = 1242, .width =  9, .advance = 10 },	/* "o" */
+	{ .offset = 1260, .width =  9, .advance = 10 },	/* "p" */
+	{ .offset = 1278, .width =  9, .advance = 10 },	/* "q" */
+	{ .offset = 1296, .width =  9, .advance = 10 },	/* "r" */
+	{ .offset = 1314, .width =  9, .advance = 10 },	/* "s" */
+	{ .offset = 1332, .width =  8, .advance =  9 },	/* "t" */
+	{ .offset = 1348, .width =  9, .advance = 10 },	/* "u" */
+	{ .offset = 1366, .width =  9, .advance = 10 },	/* "v" */
+	{ .offset = 1384, .width =  9, .advance = 10 },	/* "w" */
+	{ .offset = 1402, .width =  9, .advance = 10 },	/* "x" */
+	{ .offset = 1420, .width =  9, .advance = 10 },	/* "y" */
+	{ .offset = 1438, .width =  9, .advance = 10 },	/* "z" */
+	{ .offset = 1456, .width =  7, .advance =  8 },	/* "{" */
+	{ .offset = 1470, .width =  2, .advance =  3 },	/* "|" */
+	{ .offset = 1474, .width =  7, .advance =  8 },	/* "}" */
+	{ .offset = 1488, .width =  8, .advance =  9 },	/* "~" */
+	{ .offset = 1504, .width =  5, .advance =  6 },	/* Glyph 95 */
+	{ .offset = 1514, .width =  9, .advance = 10 },	/* Glyph 96 */
+	{ .offset = 1532, .width =  9, .advance = 10 },	/* Glyph 97 */
+};
+#endif
+
+#endif /* CRCPROPFONT_H */
@@ -0,0 +1,525 @@
+
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Offline image converter for the ST7565R driver.
+		Reads PBM/PGM images and writes a .c/.h pair of ST7565R_Asset tables, vertically oriented (page ordered) like the driver's bitmaps.
+		Each asset is stored raw, run length encoded, or as indices into a table of 8x8 tiles shared by every asset, whichever is smallest.
+		Frames that come out byte for byte the same (in any asset) are stored once.
+
+	Build & Run (host):
+		gcc -O2 -o bmpconv tools/bmpconv.c
+		./bmpconv -o bitmaps crcLeft=assets/crcLeft.pbm -e raw crcSmall=assets/crcSmall.pbm -e auto intro=assets/intro0.pbm,assets/intro1.pbm,...
+		./bmpconv -p assets.pack -o animations -e rle intro=assets/intro0.pbm,assets/intro1.pbm,...
+
+	Arguments:
+		-o <name>			Write <name>.c and <name>.h (default bitmaps)
+		-p <file.pack>		Add the assets to an asset pack instead (made if it isn't there), for ST7565R_ASSET_PACK.
+							<name>.h then only numbers them: PACK_ASSET_<NAME> is the asset's index in the pack
+		-e <encoding>		raw, rle, tiled or auto (default). Applies to the assets after it
+		-i					Invert the assets after it (light pixels are drawn)
+		<NAME>=<files>		An asset named asset_<NAME>, one comma separated image per frame. Every frame must be the same size
+
+	Images:
+		PBM (P1/P4) and PGM (P2/P5). Black pixels (PGM: darker than half of maxval) are drawn.
+		Convert anything else first, e.g. "magick logo.png logo.pbm"
+
+	Encodings (ST7565R_AssetEncoding):
+		raw			width bytes per page, page after page. Can also be handed straight to ST7565R_paintBitmap()
+		rle			The raw bytes as runs: a control byte c, then either c + 1 literal bytes (c < 0x80),
+					or one byte repeated (c & 0x7F) + 1 times (c >= 0x80). Runs carry on from one page to the next
+		tiled		One byte per 8 column by 1 page tile, (width + 7) / 8 per page, indexing the shared tile table
+
+	Pack format (all little endian, tables 4 byte aligned so a mapped pack is used in place. Also written by tools/fontconv.c -p):
+		Header		'S' '7' 'A' 'P', version (1), 0, entries (uint16), index offset (uint32), pack size (uint32)
+		Data		What the entries point at, every run of a converter adds its own after the last one
+		Index		28 bytes an entry: kind (0 asset, 1 fixed font, 2 proportional font), encoding, width, height, frames or glyphs
+					(uint16 each), first and last character, ascent, descent (fonts, a byte each), then the offsets of the frame
+					offsets or glyph table, of the data and of the tiles, and the data's length (uint32 each). Frame offsets (uint32)
+					and glyph table offsets count from the data, glyph table entries are ST7565R_Glyph: offset (uint16), width, advance
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+#define MAX_ASSETS			64
+#define MAX_FRAMES			64
+#define MAX_TILES			256					// Tile indices are one byte
+#define MAX_DATA_BYTES		(1024 * 1024)
+#define PACK_VERSION		1					// ST7565R_PACK_VERSION
+#define PACK_HEADER_BYTES	16
+#define PACK_ENTRY_BYTES	28
+#define MAX_PACK_ENTRIES	1024
+
+enum {ENCODING_RAW, ENCODING_RLE, ENCODING_TILED, ENCODING_AUTO};
+static const char* encodingNames[] = {"ASSET_RAW", "ASSET_RLE", "ASSET_TILED"};
+
+typedef struct {
+	char name[64];
+	const char* files[MAX_FRAMES];
+	unsigned numFrames;
+	int encoding;
+	int invert;
+	unsigned width;
+	unsigned height;
+	uint32_t offsets[MAX_FRAMES];
+} Asset;
+
+static Asset assets[MAX_ASSETS];
+static unsigned numAssets;
+static uint8_t data[MAX_DATA_BYTES];			// Every stored frame, back to back
+static uint32_t dataLength;
+static uint8_t tiles[MAX_TILES][8];
+static unsigned numTiles;
+
+static int readToken(FILE* file)
+{	// Next whitespace separated number in a PNM header or plain body, skipping # comments
+	int c = fgetc(file);
+	while (c != EOF && (isspace(c) || c == '#'))
+	{
+		if (c == '#') {while (c != EOF && c != '\n') {c = fgetc(file);}}
+		c = fgetc(file);
+	}
+	if (c == EOF || !isdigit(c)) {return -1;}
+	int value = 0;
+	while (c != EOF && isdigit(c))
+	{
+		value = (value * 10) + (c - '0');
+		c = fgetc(file);
+	}
+	return value;
+}
+
+static int readBit(FILE* file)
+{	// Plain PBM pixels are single '0'/'1' characters, which don't have to be separated. 1 is black
+	int c = fgetc(file);
+	while (c != EOF && c != '0' && c != '1') {c = fgetc(file);}
+	return c == '1';
+}
+
+static uint8_t* readImage(const char* path, unsigned* width, unsigned* height, int invert)
+{	// Load a PBM/PGM as one byte per pixel, 1 meaning the pixel gets drawn
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) {return NULL;}
+	int format = (fgetc(file) == 'P') ? fgetc(file) : 0;
+	int w = readToken(file), h = readToken(file);
+	int maxval = (format == '2' || format == '5') ? readToken(file) : 1;
+	if ((format < '1' || format > '5' || format == '3') || w <= 0 || h <= 0 || maxval <= 0) {fclose(file); return NULL;}
+
+	uint8_t* pixels = calloc((size_t)w * h, 1);
+	for (int y = 0; y < h; y++)
+	{
+		int bits = 0, byte = 0;
+		for (int x = 0; x < w; x++)
+		{
+			int on;
+			switch (format)
+			{
+			case '1': on = readBit(file); break;
+			case '2': on = readToken(file) < (maxval + 1) / 2; break;
+			case '4':
+				if (bits == 0) {byte = fgetc(file); bits = 8;}				// Rows are padded to whole bytes, MSB first
+				on = (byte >> --bits) & 1;
+				break;
+			default:
+				on = (maxval > 255 ? ((fgetc(file) << 8) | fgetc(file)) : fgetc(file)) < (maxval + 1) / 2;
+				break;
+			}
+			pixels[(y * w) + x] = (uint8_t)(on ^ (invert != 0));
+		}
+	}
+	fclose(file);
+	*width = w;
+	*height = h;
+	return pixels;
+}
+
+static void packPages(const uint8_t* pixels, unsigned width, unsigned height, uint8_t* raw)
+{	// Vertical orientation: a byte per column per page, LSB is the top pixel
+	unsigned pages = (height + 7) / 8;
+	memset(raw, 0, width * pages);
+	for (unsigned y = 0; y < height; y++)
+	{
+		for (unsigned x = 0; x < width; x++)
+		{
+			if (pixels[(y * width) + x]) {raw[((y / 8) * width) + x] |= (uint8_t)(1 << (y % 8));}
+		}
+	}
+}
+
+static uint32_t encodeRLE(const uint8_t* raw, uint32_t length, uint8_t* out)
+{	// Runs of 3 or more equal bytes become 2 bytes, everything else is copied as literals
+	uint32_t in = 0, size = 0;
+	while (in < length)
+	{
+		uint32_t run = 1;
+		while (in + run < length && run < 128 && raw[in + run] == raw[in]) {run++;}
+		if (run >= 3)
+		{
+			out[size++] = (uint8_t)(0x80 | (run - 1));
+			out[size++] = raw[in];
+			in += run;
+			continue;
+		}
+		uint32_t start = in, count = 0;
+		while (in < length && count < 128)
+		{	// Literals stop where the next run of 3 starts
+			if (in + 2 < length && raw[in] == raw[in + 1] && raw[in] == raw[in + 2]) {break;}
+			in++;
+			count++;
+		}
+		out[size++] = (uint8_t)(count - 1);
+		memcpy(&out[size], &raw[start], count);
+		size += count;
+	}
+	return size;
+}
+
+static int encodeTiled(const uint8_t* raw, unsigned width, unsigned height, uint8_t* out, uint32_t* size, unsigned* newTiles, int commit)
+{	// One tile index per 8 columns of each page. Returns -1 if the shared tile table would overflow
+	unsigned pages = (height + 7) / 8, across = (width + 7) / 8, added = 0;
+	uint8_t pending[MAX_TILES][8];
+	for (unsigned page = 0; page < pages; page++)
+	{
+		for (unsigned t = 0; t < across; t++)
+		{
+			uint8_t tile[8] = {0};
+			for (unsigned i = 0; i < 8 && (t * 8) + i < width; i++) {tile[i] = raw[(page * width) + (t * 8) + i];}
+
+			unsigned index = 0;
+			while (index < numTiles && memcmp(tiles[index], tile, 8) != 0) {index++;}
+			if (index == numTiles)
+			{	// Not in the table yet, maybe already queued by this image
+				unsigned p = 0;
+				while (p < added && memcmp(pending[p], tile, 8) != 0) {p++;}
+				if (p == added)
+				{
+					if (numTiles + added >= MAX_TILES) {return -1;}
+					memcpy(pending[added++], tile, 8);
+				}
+				index = numTiles + p;
+			}
+			out[(page * across) + t] = (uint8_t)index;
+		}
+	}
+	*size = pages * across;
+	*newTiles = added;
+	if (commit)
+	{
+		memcpy(tiles[numTiles], pending, (size_t)added * 8);
+		numTiles += added;
+	}
+	return 0;
+}
+
+static uint32_t storeFrame(const uint8_t* bytes, uint32_t size)
+{	// Append a frame to the data blob, or point at an identical one already there (the asset being converted included)
+	for (unsigned a = 0; a <= numAssets && a < MAX_ASSETS; a++)
+	{
+		for (unsigned f = 0; f < assets[a].numFrames; f++)
+		{
+			uint32_t offset = assets[a].offsets[f];
+			if (offset != UINT32_MAX && offset + size <= dataLength && memcmp(&data[offset], bytes, size) == 0) {return offset;}
+		}
+	}
+	if (dataLength + size > MAX_DATA_BYTES) {fprintf(stderr, "bmpconv: too much data\n"); exit(1);}
+	memcpy(&data[dataLength], bytes, size);
+	dataLength += size;
+	return dataLength - size;
+}
+
+static int convertAsset(Asset* asset)
+{
+	static uint8_t raw[MAX_FRAMES][MAX_DATA_BYTES / MAX_FRAMES];
+	static uint8_t encoded[MAX_DATA_BYTES];
+	for (unsigned f = 0; f < asset->numFrames; f++)
+	{
+		unsigned width, height;
+		uint8_t* pixels = readImage(asset->files[f], &width, &height, asset->invert);
+		if (pixels == NULL) {fprintf(stderr, "bmpconv: can't read %s\n", asset->files[f]); return -1;}
+		if (f == 0) {asset->width = width; asset->height = height;}
+		if (width != asset->width || height != asset->height) {fprintf(stderr, "bmpconv: %s isn't the size of the first frame\n", asset->files[f]); return -1;}
+		if ((size_t)width * ((height + 7) / 8) > sizeof raw[0] || width > UINT16_MAX || height > UINT16_MAX) {fprintf(stderr, "bmpconv: %s is too big\n", asset->files[f]); return -1;}
+		packPages(pixels, width, height, raw[f]);
+		free(pixels);
+		asset->offsets[f] = UINT32_MAX;
+	}
+	uint32_t rawSize = asset->width * ((asset->height + 7) / 8);
+
+	if (asset->encoding == ENCODING_AUTO)
+	{	// Smallest total, counting the tiles a tiled asset would add to the table
+		uint32_t rleSize = 0, tiledSize = 0, size;
+		unsigned added;
+		for (unsigned f = 0; f < asset->numFrames; f++) {rleSize += encodeRLE(raw[f], rawSize, encoded);}
+		int tiledOk = 1;
+		unsigned savedTiles = numTiles;
+		for (unsigned f = 0; f < asset->numFrames && tiledOk; f++)
+		{	// Commit as we go so later frames reuse earlier frames' tiles, then put the table back
+			tiledOk = encodeTiled(raw[f], asset->width, asset->height, encoded, &size, &added, 1) == 0;
+			tiledSize += size + (added * 8);
+		}
+		numTiles = savedTiles;
+		asset->encoding = ENCODING_RAW;
+		uint32_t best = rawSize * asset->numFrames;
+		if (rleSize < best) 				{asset->encoding = ENCODING_RLE; 	best = rleSize;}
+		if (tiledOk && tiledSize < best) 	{asset->encoding = ENCODING_TILED;}
+	}
+
+	for (unsigned f = 0; f < asset->numFrames; f++)
+	{
+		uint32_t size = rawSize;
+		unsigned added;
+		const uint8_t* bytes = raw[f];
+		if (asset->encoding == ENCODING_RLE)
+		{
+			size = encodeRLE(raw[f], rawSize, encoded);
+			bytes = encoded;
+		}
+		else if (asset->encoding == ENCODING_TILED)
+		{
+			if (encodeTiled(raw[f], asset->width, asset->height, encoded, &size, &added, 1) != 0)
+			{
+				fprintf(stderr, "bmpconv: more than %d different tiles, use -e rle for %s\n", MAX_TILES, asset->name);
+				return -1;
+			}
+			bytes = encoded;
+		}
+		asset->offsets[f] = storeFrame(bytes, size);
+	}
+	return 0;
+}
+
+static void printBytes(FILE* out, const uint8_t* bytes, uint32_t length)
+{
+	for (uint32_t i = 0; i < length; i++)
+	{
+		fprintf(out, "%s0x%02x,", (i % 24 == 0) ? "\n\t" : " ", bytes[i]);
+	}
+	if (length == 0) {fprintf(out, "\n\t0x00");}
+	fprintf(out, "\n");
+}
+
+static void putWord(uint8_t* bytes, uint32_t value)
+{
+	for (int i = 0; i < 4; i++) {bytes[i] = (uint8_t)(value >> (8 * i));}
+}
+
+static uint32_t getWord(const uint8_t* bytes)
+{
+	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static int appendPack(const char* path, const uint8_t* blob, uint32_t blobLength, uint8_t entries[][PACK_ENTRY_BYTES], unsigned numEntries, unsigned* first)
+{	// Add entries to the pack at path, or start one. Their table, data and tiles offsets count from the start of blob. The old index is
+	// dropped, blob goes where it started and the whole index after it
+	static uint8_t old[MAX_DATA_BYTES + (MAX_PACK_ENTRIES * PACK_ENTRY_BYTES)];
+	static uint8_t index[MAX_PACK_ENTRIES][PACK_ENTRY_BYTES];
+	uint32_t base = PACK_HEADER_BYTES, oldCount = 0;
+	FILE* file = fopen(path, "rb");
+	if (file != NULL)
+	{
+		size_t size = fread(old, 1, sizeof old, file);
+		fclose(file);
+		if (size < PACK_HEADER_BYTES || memcmp(old, "S7AP", 4) != 0 || old[4] != PACK_VERSION) {fprintf(stderr, "bmpconv: %s isn't a version %d pack\n", path, PACK_VERSION); return -1;}
+		oldCount = old[6] | (old[7] << 8);
+		base = getWord(&old[8]);
+		if (getWord(&old[12]) != size || base + (oldCount * PACK_ENTRY_BYTES) > size) {fprintf(stderr, "bmpconv: %s is cut short\n", path); return -1;}
+		memcpy(index, &old[base], oldCount * PACK_ENTRY_BYTES);
+	}
+	if (oldCount + numEntries > MAX_PACK_ENTRIES) {fprintf(stderr, "bmpconv: more than %d entries in %s\n", MAX_PACK_ENTRIES, path); return -1;}
+	for (unsigned e = 0; e < numEntries; e++)
+	{
+		uint8_t* entry = index[oldCount + e];
+		memcpy(entry, entries[e], PACK_ENTRY_BYTES);
+		putWord(&entry[12], getWord(&entry[12]) + base);
+		putWord(&entry[16], getWord(&entry[16]) + base);
+		if (getWord(&entry[24]) != 0) {putWord(&entry[24], getWord(&entry[24]) + base);}
+	}
+
+	uint32_t indexOffset = (base + blobLength + 3) & ~3u;
+	uint32_t count = oldCount + numEntries;
+	uint8_t header[PACK_HEADER_BYTES] = {'S', '7', 'A', 'P', PACK_VERSION, 0, (uint8_t)count, (uint8_t)(count >> 8)};
+	putWord(&header[8], indexOffset);
+	putWord(&header[12], indexOffset + (count * PACK_ENTRY_BYTES));
+	static const uint8_t zeros[4];
+	file = fopen(path, "wb");
+	if (file == NULL) {fprintf(stderr, "bmpconv: can't write %s\n", path); return -1;}
+	fwrite(header, 1, sizeof header, file);
+	if (base > PACK_HEADER_BYTES) {fwrite(&old[PACK_HEADER_BYTES], 1, base - PACK_HEADER_BYTES, file);}
+	fwrite(blob, 1, blobLength, file);
+	fwrite(zeros, 1, indexOffset - (base + blobLength), file);
+	fwrite(index, PACK_ENTRY_BYTES, count, file);
+	fclose(file);
+	*first = oldCount;
+	return 0;
+}
+
+static int writePack(const char* path, const char* outName)
+{	// The assets as pack entries: each one's frame offsets, then the data and tiles every asset of this run shares
+	static uint8_t blob[(MAX_ASSETS * MAX_FRAMES * 4) + MAX_DATA_BYTES + (MAX_TILES * 8) + 4];
+	static uint8_t entries[MAX_ASSETS][PACK_ENTRY_BYTES];
+	uint32_t length = 0;
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		uint8_t* entry = entries[a];
+		memset(entry, 0, PACK_ENTRY_BYTES);				// Kind 0, an asset
+		entry[1] = (uint8_t)assets[a].encoding;
+		entry[2] = (uint8_t)assets[a].width;	entry[3] = (uint8_t)(assets[a].width >> 8);
+		entry[4] = (uint8_t)assets[a].height;	entry[5] = (uint8_t)(assets[a].height >> 8);
+		entry[6] = (uint8_t)assets[a].numFrames;	entry[7] = (uint8_t)(assets[a].numFrames >> 8);
+		putWord(&entry[12], length);
+		for (unsigned f = 0; f < assets[a].numFrames; f++, length += 4) {putWord(&blob[length], assets[a].offsets[f]);}
+	}
+	uint32_t dataStart = length;
+	memcpy(&blob[length], data, dataLength);
+	length = (length + dataLength + 3) & ~3u;
+	uint32_t tilesStart = length;
+	memcpy(&blob[length], tiles, numTiles * 8);
+	length += numTiles * 8;
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		putWord(&entries[a][16], dataStart);
+		putWord(&entries[a][20], dataLength);
+		if (assets[a].encoding == ENCODING_TILED) {putWord(&entries[a][24], tilesStart);}
+	}
+	unsigned first;
+	if (appendPack(path, blob, length, entries, numAssets, &first) != 0) {return -1;}
+
+	char header[256], guard[128];
+	snprintf(header, sizeof header, "%s.h", outName);
+	snprintf(guard, sizeof guard, "%s_H", outName);
+	for (char* c = guard; *c; c++) {*c = isalnum((unsigned char)*c) ? toupper((unsigned char)*c) : '_';}
+	const char* base = strrchr(outName, '/') ? strrchr(outName, '/') + 1 : outName;
+	FILE* file = fopen(header, "w");
+	if (file == NULL) {fprintf(stderr, "bmpconv: can't write %s\n", header); return -1;}
+	fprintf(file, "\n/*\n * %s.h\n *\n", base);
+	fprintf(file, " * Generated by tools/bmpconv.c, numbers of the assets it added to %s. Do not edit by hand, re-run the converter instead.\n", path);
+	fprintf(file, " * Paint an asset with ST7565R_paintPackAsset(&pack, PACK_ASSET_<NAME>, frame, x, y).\n */\n\n");
+	fprintf(file, "#ifndef %s\n#define %s\n\n", guard, guard);
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		char name[64];
+		memcpy(name, assets[a].name, sizeof name);
+		for (char* c = name; *c; c++) {*c = toupper((unsigned char)*c);}
+		fprintf(file, "#define PACK_ASSET_%s\t\t%u\t\t// %ux%u, %u frame%s\n", name, first + a,
+				assets[a].width, assets[a].height, assets[a].numFrames, (assets[a].numFrames == 1) ? "" : "s");
+	}
+	fprintf(file, "\n#endif /* %s */\n", guard);
+	fclose(file);
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	const char* outName = "bitmaps";
+	const char* packName = NULL;
+	int encoding = ENCODING_AUTO, invert = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) 	{outName = argv[++i]; continue;}
+		if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) 	{packName = argv[++i]; continue;}
+		if (strcmp(argv[i], "-i") == 0) 					{invert = 1; continue;}
+		if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+		{
+			const char* name = argv[++i];
+			if 		(strcmp(name, "raw") == 0) 		{encoding = ENCODING_RAW;}
+			else if (strcmp(name, "rle") == 0) 		{encoding = ENCODING_RLE;}
+			else if (strcmp(name, "tiled") == 0) 	{encoding = ENCODING_TILED;}
+			else if (strcmp(name, "auto") == 0) 	{encoding = ENCODING_AUTO;}
+			else {fprintf(stderr, "bmpconv: unknown encoding %s\n", name); return 1;}
+			continue;
+		}
+
+		char* equals = strchr(argv[i], '=');
+		if (equals == NULL || equals == argv[i] || numAssets == MAX_ASSETS || (size_t)(equals - argv[i]) >= sizeof assets[0].name)
+		{
+			fprintf(stderr, "usage: %s [-o name] [-p file.pack] [-e raw|rle|tiled|auto] [-i] <NAME>=<image>[,<image>...] ...\n", argv[0]);
+			return 1;
+		}
+		Asset* asset = &assets[numAssets];
+		memcpy(asset->name, argv[i], equals - argv[i]);
+		asset->encoding = encoding;
+		asset->invert = invert;
+		for (char* file = strtok(equals + 1, ","); file != NULL && asset->numFrames < MAX_FRAMES; file = strtok(NULL, ","))
+		{
+			asset->files[asset->numFrames++] = file;
+		}
+		if (convertAsset(asset) != 0) {return 1;}
+		numAssets++;
+	}
+	if (numAssets == 0) {fprintf(stderr, "bmpconv: no assets\n"); return 1;}
+	if (packName != NULL)
+	{
+		if (writePack(packName, outName) != 0) {return 1;}
+		fprintf(stderr, "%u assets added to %s, %u data bytes, %u tiles\n", numAssets, packName, dataLength, numTiles);
+		return 0;
+	}
+
+	char path[256], guard[128];
+	snprintf(guard, sizeof guard, "%s_H", outName);
+	for (char* c = guard; *c; c++) {*c = isalnum((unsigned char)*c) ? toupper((unsigned char)*c) : '_';}
+	const char* base = strrchr(outName, '/') ? strrchr(outName, '/') + 1 : outName;
+
+	snprintf(path, sizeof path, "%s.h", outName);
+	FILE* header = fopen(path, "w");
+	if (header == NULL) {fprintf(stderr, "bmpconv: can't write %s\n", path); return 1;}
+	fprintf(header, "\n/*\n * %s.h\n *\n", base);
+	fprintf(header, " * Generated by tools/bmpconv.c. Do not edit by hand, change the images and re-run the converter instead.\n");
+	fprintf(header, " * Paint an asset with ST7565R_paintAsset(&asset_<name>, frame, x, y).\n */\n\n");
+	fprintf(header, "#ifndef %s\n#define %s\n\n#include \"ST7565R.h\"\n\n", guard, guard);
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		fprintf(header, "extern const ST7565R_Asset asset_%s;\t\t// %ux%u, %u frame%s\n", assets[a].name,
+				assets[a].width, assets[a].height, assets[a].numFrames, (assets[a].numFrames == 1) ? "" : "s");
+	}
+	fprintf(header, "\n#endif /* %s */\n", guard);
+	fclose(header);
+
+	snprintf(path, sizeof path, "%s.c", outName);
+	FILE* source = fopen(path, "w");
+	if (source == NULL) {fprintf(stderr, "bmpconv: can't write %s\n", path); return 1;}
+	fprintf(source, "\n/*\n * %s.c\n *\n * Generated by tools/bmpconv.c from:\n", base);
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		fprintf(source, " *\t%s (%s):", assets[a].name, encodingNames[assets[a].encoding]);
+		for (unsigned f = 0; f < assets[a].numFrames; f++) {fprintf(source, " %s", assets[a].files[f]);}
+		fprintf(source, "\n");
+	}
+	fprintf(source, " * Do not edit by hand, change the images and re-run the converter instead.\n */\n\n#include \"%s.h\"\n\n", base);
+
+	fprintf(source, "/* Every frame, %u bytes. Identical frames are stored once. */\n", dataLength);
+	fprintf(source, "static const uint8_t assetData[] = {");
+	printBytes(source, data, dataLength);
+	fprintf(source, "};\n\n");
+	if (numTiles > 0)
+	{
+		fprintf(source, "/* 8 column by 1 page tiles shared by the ASSET_TILED assets, %u tiles. */\n", numTiles);
+		fprintf(source, "static const uint8_t assetTiles[] = {");
+		printBytes(source, &tiles[0][0], numTiles * 8);
+		fprintf(source, "};\n\n");
+	}
+
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		Asset* asset = &assets[a];
+		fprintf(source, "static const uint32_t %sFrames[] = {", asset->name);
+		for (unsigned f = 0; f < asset->numFrames; f++) {fprintf(source, "%s%u", (f == 0) ? " " : ", ", asset->offsets[f]);}
+		fprintf(source, " };\n");
+		fprintf(source, "const ST7565R_Asset asset_%s = {\n", asset->name);
+		fprintf(source, "\t.width = \t\t\t%u,\n\t.height = \t\t\t%u,\n\t.frames = \t\t\t%u,\n", asset->width, asset->height, asset->numFrames);
+		fprintf(source, "\t.encoding = \t\t%s,\n\t.frameOffsets = \t%sFrames,\n\t.data = \t\t\tassetData,\n", encodingNames[asset->encoding], asset->name);
+		fprintf(source, "\t.tiles = \t\t\t%s\n};\n\n", (asset->encoding == ENCODING_TILED) ? "assetTiles" : "NULL");
+	}
+	fclose(source);
+
+	for (unsigned a = 0; a < numAssets; a++)
+	{
+		fprintf(stderr, "%s: %ux%u, %u frames, %s\n", assets[a].name, assets[a].width, assets[a].height, assets[a].numFrames, encodingNames[assets[a].encoding]);
+	}
+	fprintf(stderr, "%u data bytes, %u tiles\n", dataLength, numTiles);
+	return 0;
+}
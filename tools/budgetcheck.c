@@ -0,0 +1,169 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host check for ST7565R_updateDisplayBudget(). Paints random rectangles, pixels and bitmaps, then updates with random
+		budgets against the model of the controller in tools/host, and after every call checks the bytes that went over the
+		wire, commands and the DISPLAY_ON kept back for the end included, fit in maxMicroseconds * ST7565R_SPI_CLOCK_HZ / 8000000,
+		that the driver's own count (ST7565R_getFlushStats()) agrees and that the display was left on. Every few rounds it
+		keeps calling with a small fixed budget and checks the update finishes within one call per screen byte, with lastScreen
+		and the display RAM both holding the painted frame. Exits with 1 on the first failure.
+		It includes ST7565R.c rather than linking it to see curScreen and lastScreen, so don't add ST7565R.c to the gcc line.
+
+	Build & Run (host):
+		gcc -O2 -Itools/host -I. -o budgetcheck tools/budgetcheck.c tools/host/hostpanel.c bitmaps.c
+		./budgetcheck
+		./budgetcheck -r 100000 -s 7 -u 40
+		Add -DRETAIN_CURSCREEN or -DST7565R_ROTATE_90 to the gcc line to check those builds
+
+	Arguments:
+		-r <rounds>			Rounds of painting and updating (default 20000)
+		-s <seed>			Random seed (default 1)
+		-u <us>				Budget of the fixed budget updates (default 100). Needs to fit a page address, a column address,
+							DISPLAY_OFF/ON and a byte
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "../ST7565R.c"
+#include "hostpanel.h"
+
+#if defined(PAINT_IMMEDIATELY) || defined(ST7565R_STRIP_MODE) || defined(ST7565R_FRAME_HANDOFF) || defined(ST7565R_DISPLAY_LIST)
+#error "Only the default buffered mode stops an update part way, build budgetcheck without the other modes"
+#endif
+
+static uint32_t state = 1;
+static unsigned long calls = 0;
+
+static uint32_t nextRandom(void)
+{	// xorshift32, the same sequence on every host
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+static void paintRandom(void)
+{	// One rectangle, pixel or bitmap, drawn or erased, somewhere on or partly off the screen
+	static uint8_t bitmap[24 * 3];
+	ST7565R_DrawState drawOrErase 	= (nextRandom() % 4 != 0) ? DRAW : ERASE;
+	unsigned x 						= nextRandom() % (DRAWWIDTH + 8);
+	unsigned y 						= nextRandom() % (DRAWHEIGHT + 8);
+	unsigned width 					= 1 + (nextRandom() % 24);
+	unsigned height 				= 1 + (nextRandom() % 24);
+	switch (nextRandom() % 3)
+	{
+	case 0: ST7565R_paintRectangle(drawOrErase, x, y, width, height); break;
+	case 1: ST7565R_paintPixel(drawOrErase, x, y); break;
+	default:
+		for (unsigned i = 0; i < sizeof(bitmap); i++) {bitmap[i] = (uint8_t)nextRandom();}
+		ST7565R_paintBitmap(bitmap, x, y, width, height);
+		break;
+	}
+}
+
+static int budgetedUpdate(uint32_t maxMicroseconds, bool* complete)
+{	// One ST7565R_updateDisplayBudget() call, checked against its budget. Returns 0 when it went over
+	unsigned long before 	= hostPanelBytes();
+	*complete 				= ST7565R_updateDisplayBudget(maxMicroseconds);
+	unsigned long sent 		= hostPanelBytes() - before;
+	uint64_t allowed 		= ((uint64_t)maxMicroseconds * ST7565R_SPI_CLOCK_HZ) / 8000000;
+	calls++;
+	if (sent > allowed)
+	{
+		printf("OVER  call %lu: %lu bytes in %lu us, %lu allowed\n", calls, sent, (unsigned long)maxMicroseconds, (unsigned long)allowed);
+		return 0;
+	}
+	if (ST7565R_getFlushStats().lastBytes != sent)
+	{
+		printf("COUNT call %lu: %lu bytes sent, the driver counted %lu\n", calls, sent, (unsigned long)ST7565R_getFlushStats().lastBytes);
+		return 0;
+	}
+	if (!hostPanel.displayOn)
+	{
+		printf("OFF   call %lu: the display was left off after %lu bytes\n", calls, sent);
+		return 0;
+	}
+	return 1;
+}
+
+static int converge(uint32_t maxMicroseconds, const uint8_t* frame, bool complete)
+{	// Fixed budget updates until one reports the frame done, unless the last one already did (another would send the cleared
+	// curScreen without RETAIN_CURSCREEN). Each sends at least one byte, so a screen's worth of calls is plenty
+	unsigned rounds = 0;
+	while (!complete)
+	{
+		if (++rounds > SCREENBYTES + 1)
+		{
+			printf("STUCK call %lu: not done after %u calls of %lu us\n", calls, SCREENBYTES + 1, (unsigned long)maxMicroseconds);
+			return 0;
+		}
+		if (!budgetedUpdate(maxMicroseconds, &complete)) {return 0;}
+	}
+	if (memcmp(lastScreen, frame, SCREENBYTES) != 0)
+	{
+		printf("LAST  call %lu: done, but lastScreen isn't the painted frame\n", calls);
+		return 0;
+	}
+#ifdef RETAIN_CURSCREEN
+	if (memcmp(lastScreen, curScreen, SCREENBYTES) != 0)
+	{
+		printf("LAST  call %lu: done, but lastScreen isn't curScreen\n", calls);
+		return 0;
+	}
+#endif
+	for (unsigned page = 0; page < SCREENPAGES; page++)
+	{
+		if (memcmp(hostPanel.ram[page], &frame[SCREENWIDTH * page], SCREENWIDTH) != 0)
+		{
+			printf("RAM   call %lu: done, but page %u of the display RAM isn't the painted frame\n", calls, page);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int main(int argc, char** argv)
+{
+	unsigned long rounds = 20000;
+	uint32_t fixedBudget = 100;
+	int option;
+	while ((option = getopt(argc, argv, "r:s:u:")) != -1)
+	{
+		switch (option)
+		{
+		case 'r': rounds 		= strtoul(optarg, NULL, 0); break;
+		case 's': state 		= (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 'u': fixedBudget 	= (uint32_t)strtoul(optarg, NULL, 0); break;
+		default:  optind 		= argc + 1; break;
+		}
+	}
+	if (argc != optind || rounds == 0 || ((uint64_t)fixedBudget * ST7565R_SPI_CLOCK_HZ) / 8000000 < 6)
+	{
+		fprintf(stderr, "usage: %s [-r rounds] [-s seed] [-u us, at least %lu]\n", argv[0], (unsigned long)(6 * 8000000ULL / ST7565R_SPI_CLOCK_HZ));
+		return 2;
+	}
+	if (state == 0) {state = 1;}
+
+	ST7565R_setup();
+	static uint8_t frame[SCREENBYTES];
+	unsigned long partial = 0;
+	for (unsigned long round = 0; round < rounds; round++)
+	{
+		unsigned paints = nextRandom() % 6;
+		for (unsigned i = 0; i < paints; i++) {paintRandom();}
+		memcpy(frame, curScreen, SCREENBYTES);			// Before any update, which clears curScreen once it's done without RETAIN_CURSCREEN
+
+		bool complete;
+		if (!budgetedUpdate(nextRandom() % 1500, &complete)) {return 1;}	// Anything from nothing at all to most of a screen
+		if (!complete) {partial++;}
+		if ((round % 8 == 0 || complete) && !converge(fixedBudget, frame, complete)) {return 1;}
+	}
+	printf("%lu rounds, %lu budgeted updates (%lu stopped part way), %lu bytes sent, at most %lu in one update\n", rounds, calls, partial,
+			hostPanelBytes(), (unsigned long)ST7565R_getFlushStats().maxBytes);
+	return 0;
+}
@@ -0,0 +1,363 @@
+
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Offline font converter for the ST7565R driver.
+		Reads a fixed width, horizontally oriented font header (like crcFont.h) and writes a proportional font header
+		with vertically oriented (page ordered) glyph bitmaps, a per-glyph advance table and ascent/descent metrics.
+		The output can be painted by the driver a byte at a time instead of a pixel at a time.
+
+	Build & Run (host):
+		gcc -O2 -o fontconv tools/fontconv.c
+		./fontconv -l 126 crcFont.h 10 15 32 CRC > crcPropFont.h
+		./fontconv -p fonts.pack -l 126 crcFont.h 10 15 32 CRC > crcPropPack.h
+
+	Arguments:
+		<font.h>		Header containing exactly one glyph array (the first {...} initializer after a [] is used)
+		<width>			Glyph width in pixels, as #defined in the source font
+		<height>		Glyph height in pixels, as #defined in the source font
+		<firstChar>		Code of the first glyph in the array
+		<NAME>			Name used for the generated macros and arrays (CRC -> CRCPROPFONT_*, fontCRCProp*)
+		-s <spacing>	Blank columns appended to each glyph's advance (default 1)
+		-a <advance>	Advance of blank glyphs such as ' ' (default width / 2)
+		-l <lastChar>	Code of the last contiguous character (default: every glyph in the array).
+						Glyphs after it are extra symbols, reached through the font's code point ranges.
+						The generated glyph table keeps the source glyph order so the ranges stay valid.
+		-p <file.pack>	Add the font to an asset pack instead (made if it isn't there, see tools/bmpconv.c for the format), for
+						ST7565R_ASSET_PACK. The header then only has the metrics and <NAME>..._PACK_INDEX, the font's index in the pack
+		-f				With -p: add the font as it is, fixed width and horizontal, instead of converting it
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#define MAX_FONT_BYTES		65536
+#define MAX_GLYPHS			256
+#define PACK_VERSION		1					// ST7565R_PACK_VERSION
+#define PACK_HEADER_BYTES	16
+#define PACK_ENTRY_BYTES	28
+#define MAX_PACK_ENTRIES	1024
+#define MAX_PACK_BYTES		(1024 * 1024)
+
+static uint8_t src[MAX_FONT_BYTES];
+static unsigned srcLength;
+
+static char* readFile(const char* path)
+{	// Read a whole file into a NUL terminated buffer
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) {return NULL;}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	char* text = malloc(size + 1);
+	if (text == NULL || fread(text, 1, size, file) != (size_t)size) {fclose(file); free(text); return NULL;}
+	text[size] = '\0';
+	fclose(file);
+	return text;
+}
+
+static void stripComments(char* text)
+{	// Blank out C and C++ comments so glyph labels like /* "}" */ can't confuse the parser
+	for (char* p = text; *p; p++)
+	{
+		if (p[0] == '/' && p[1] == '*')
+		{
+			char* end = strstr(p + 2, "*/");
+			end = (end == NULL) ? p + strlen(p) : end + 2;
+			memset(p, ' ', end - p);
+			p = end - 1;
+		}
+		else if (p[0] == '/' && p[1] == '/')
+		{
+			while (*p && *p != '\n') {*p++ = ' ';}
+			if (*p == '\0') {break;}
+		}
+	}
+}
+
+static int parseGlyphArray(char* text)
+{	// Collect every number in the first "[] = { ... }" initializer
+	char* p = strstr(text, "[]");
+	if (p == NULL) {return -1;}
+	p = strchr(p, '{');
+	if (p == NULL) {return -1;}
+	p++;
+
+	while (*p && *p != '}')
+	{
+		if (isdigit((unsigned char)*p))
+		{
+			char* end;
+			unsigned long value = strtoul(p, &end, 0);
+			if (srcLength >= MAX_FONT_BYTES) {return -1;}
+			src[srcLength++] = (uint8_t)value;
+			p = end;
+			continue;
+		}
+		p++;
+	}
+	return (*p == '}') ? 0 : -1;
+}
+
+static int srcPixel(unsigned glyph, unsigned bytesPerRow, unsigned bytesPerChar, unsigned x, unsigned y)
+{	// Horizontal source layout: rows of bytes, MSB is the leftmost pixel
+	uint8_t byte = src[(glyph * bytesPerChar) + (y * bytesPerRow) + (x / 8)];
+	return (byte & (0b10000000 >> (x % 8))) != 0;
+}
+
+static uint8_t verticalByte(unsigned glyph, unsigned bytesPerRow, unsigned bytesPerChar, unsigned height, unsigned x, unsigned page)
+{	// 8 rows of a source column as a page byte, LSB is the top pixel
+	uint8_t byte = 0;
+	for (unsigned bit = 0; bit < 8; bit++)
+	{
+		unsigned y = (page * 8) + bit;
+		if (y < height && srcPixel(glyph, bytesPerRow, bytesPerChar, x, y)) {byte |= (0b00000001 << bit);}
+	}
+	return byte;
+}
+
+static void putWord(uint8_t* bytes, uint32_t value)
+{
+	for (int i = 0; i < 4; i++) {bytes[i] = (uint8_t)(value >> (8 * i));}
+}
+
+static uint32_t getWord(const uint8_t* bytes)
+{
+	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static int appendPack(const char* path, const uint8_t* blob, uint32_t blobLength, uint8_t entry[PACK_ENTRY_BYTES], unsigned* index)
+{	// Add an entry to the pack at path, or start one, like tools/bmpconv.c does. Its table and data offsets count from the start of blob.
+	// The old index is dropped, blob goes where it started and the whole index after it
+	static uint8_t old[MAX_PACK_BYTES];
+	uint32_t base = PACK_HEADER_BYTES, oldCount = 0;
+	FILE* file = fopen(path, "rb");
+	if (file != NULL)
+	{
+		size_t size = fread(old, 1, sizeof old, file);
+		fclose(file);
+		if (size < PACK_HEADER_BYTES || memcmp(old, "S7AP", 4) != 0 || old[4] != PACK_VERSION) {fprintf(stderr, "fontconv: %s isn't a version %d pack\n", path, PACK_VERSION); return -1;}
+		oldCount = old[6] | (old[7] << 8);
+		base = getWord(&old[8]);
+		if (getWord(&old[12]) != size || base + (oldCount * PACK_ENTRY_BYTES) > size) {fprintf(stderr, "fontconv: %s is cut short\n", path); return -1;}
+	}
+	if (oldCount + 1 > MAX_PACK_ENTRIES) {fprintf(stderr, "fontconv: more than %d entries in %s\n", MAX_PACK_ENTRIES, path); return -1;}
+	putWord(&entry[12], getWord(&entry[12]) + base);
+	putWord(&entry[16], getWord(&entry[16]) + base);
+
+	uint32_t indexOffset = (base + blobLength + 3) & ~3u;
+	uint32_t count = oldCount + 1;
+	uint8_t header[PACK_HEADER_BYTES] = {'S', '7', 'A', 'P', PACK_VERSION, 0, (uint8_t)count, (uint8_t)(count >> 8)};
+	putWord(&header[8], indexOffset);
+	putWord(&header[12], indexOffset + (count * PACK_ENTRY_BYTES));
+	static const uint8_t zeros[4];
+	file = fopen(path, "wb");
+	if (file == NULL) {fprintf(stderr, "fontconv: can't write %s\n", path); return -1;}
+	fwrite(header, 1, sizeof header, file);
+	if (base > PACK_HEADER_BYTES) {fwrite(&old[PACK_HEADER_BYTES], 1, base - PACK_HEADER_BYTES, file);}
+	fwrite(blob, 1, blobLength, file);
+	fwrite(zeros, 1, indexOffset - (base + blobLength), file);
+	fwrite(&old[base], PACK_ENTRY_BYTES, oldCount, file);
+	fwrite(entry, PACK_ENTRY_BYTES, 1, file);
+	fclose(file);
+	*index = oldCount;
+	return 0;
+}
+
+static void printGlyphLabel(unsigned glyph, unsigned firstChar, int lastChar)
+{	// Comment naming the glyph, extra symbols are only known by their glyph index
+	unsigned c = firstChar + glyph;
+	if ((int)c <= lastChar && c >= 32 && c < 127) {printf("\t/* \"%c\" */\n", c);}
+	else {printf("\t/* Glyph %u */\n", glyph);}
+}
+
+int main(int argc, char** argv)
+{
+	int spacing = 1, spaceAdv = -1, lastChar = -1, fixed = 0, option;
+	const char* pack = NULL;
+	while ((option = getopt(argc, argv, "s:a:l:p:f")) != -1)
+	{
+		switch (option)
+		{
+		case 'p': pack 		= optarg; break;
+		case 'f': fixed 	= 1; break;
+		case 's': spacing 	= atoi(optarg); break;
+		case 'a': spaceAdv 	= atoi(optarg); break;
+		case 'l': lastChar 	= atoi(optarg); break;
+		default:  optind 	= argc + 1; break;
+		}
+	}
+	if (argc - optind != 5)
+	{
+		fprintf(stderr, "usage: %s [-s spacing] [-a spaceAdvance] [-l lastChar] [-p file.pack [-f]] <font.h> <width> <height> <firstChar> <NAME>\n", argv[0]);
+		return 1;
+	}
+
+	const char* path	= argv[optind];
+	unsigned width		= (unsigned)atoi(argv[optind + 1]);
+	unsigned height		= (unsigned)atoi(argv[optind + 2]);
+	unsigned firstChar	= (unsigned)atoi(argv[optind + 3]);
+	const char* name	= argv[optind + 4];
+	if (spaceAdv < 0) {spaceAdv = width / 2;}
+
+	char* text = readFile(path);
+	if (text == NULL) {fprintf(stderr, "fontconv: can't read %s\n", path); return 1;}
+	stripComments(text);
+	if (parseGlyphArray(text) != 0) {fprintf(stderr, "fontconv: no glyph array in %s\n", path); return 1;}
+	free(text);
+
+	unsigned bytesPerRow	= (width + 7) / 8;
+	unsigned bytesPerChar	= bytesPerRow * height;
+	unsigned pages			= (height + 7) / 8;
+	unsigned numGlyphs		= srcLength / bytesPerChar;
+	if (numGlyphs == 0 || numGlyphs > MAX_GLYPHS) {fprintf(stderr, "fontconv: bad glyph count %u\n", numGlyphs); return 1;}
+	if (lastChar < 0 || (unsigned)lastChar >= firstChar + numGlyphs) {lastChar = firstChar + numGlyphs - 1;}
+
+	// Baseline sits under the lowest inked row of 'A' (falls back to the full height)
+	unsigned ascent = height;
+	if ('A' >= firstChar && 'A' < firstChar + numGlyphs)
+	{
+		for (int y = height - 1; y >= 0; y--)
+		{
+			int inked = 0;
+			for (unsigned x = 0; x < width; x++) {inked |= srcPixel('A' - firstChar, bytesPerRow, bytesPerChar, x, y);}
+			if (inked) {ascent = y + 1; break;}
+		}
+	}
+
+	char upper[64], lower[64], file[64];
+	snprintf(upper, sizeof upper, "%sPROPFONT", name);
+	for (char* c = upper; *c; c++) {*c = toupper((unsigned char)*c);}
+	snprintf(lower, sizeof lower, "font%sProp", name);
+	snprintf(file, sizeof file, "%sPropFont.h", name);
+	for (size_t i = 0; i < strlen(name); i++) {file[i] = tolower((unsigned char)file[i]);}
+
+	unsigned firstCol[MAX_GLYPHS], glyphWidth[MAX_GLYPHS], advance[MAX_GLYPHS], offset[MAX_GLYPHS];
+	unsigned totalBytes = 0, maxAdvance = 0;
+	for (unsigned g = 0; g < numGlyphs; g++)
+	{	// Trim blank columns on both sides of the glyph
+		int left = -1, right = -1;
+		for (unsigned x = 0; x < width; x++)
+		{
+			for (unsigned y = 0; y < height; y++)
+			{
+				if (srcPixel(g, bytesPerRow, bytesPerChar, x, y))
+				{
+					if (left < 0) {left = x;}
+					right = x;
+					break;
+				}
+			}
+		}
+		firstCol[g]		= (left < 0) ? 0 : left;
+		glyphWidth[g]	= (left < 0) ? 0 : (right - left + 1);
+		advance[g]		= (left < 0) ? (unsigned)spaceAdv : (glyphWidth[g] + spacing);
+		offset[g]		= totalBytes;
+		totalBytes		+= glyphWidth[g] * pages;
+		if (advance[g] > maxAdvance) {maxAdvance = advance[g];}
+	}
+
+	if (pack != NULL)
+	{	// Proportional: the glyph table, then the glyphs. Fixed: the source glyphs as they are
+		static uint8_t blob[(MAX_GLYPHS * 4) + MAX_PACK_BYTES];
+		uint8_t entry[PACK_ENTRY_BYTES] = {fixed ? 1 : 2, 0, (uint8_t)width, 0, (uint8_t)height, 0, (uint8_t)numGlyphs, (uint8_t)(numGlyphs >> 8),
+										   (uint8_t)firstChar, (uint8_t)lastChar, (uint8_t)ascent, (uint8_t)(height - ascent)};
+		uint32_t dataStart = 0, length = numGlyphs * bytesPerChar;
+		if (fixed)
+		{
+			memcpy(blob, src, length);
+			entry[10] = entry[11] = 0;
+		}
+		else
+		{
+			if (totalBytes > UINT16_MAX) {fprintf(stderr, "fontconv: %u bytes of glyphs, more than a glyph table can reach\n", totalBytes); return 1;}
+			entry[2] = (uint8_t)maxAdvance;
+			dataStart = numGlyphs * 4;
+			length = totalBytes;
+			for (unsigned g = 0; g < numGlyphs; g++)
+			{
+				uint8_t* glyph = &blob[g * 4];
+				glyph[0] = (uint8_t)offset[g];	glyph[1] = (uint8_t)(offset[g] >> 8);	glyph[2] = (uint8_t)glyphWidth[g];	glyph[3] = (uint8_t)advance[g];
+				for (unsigned page = 0; page < pages; page++)
+				{
+					for (unsigned col = 0; col < glyphWidth[g]; col++)
+					{
+						blob[dataStart + offset[g] + (page * glyphWidth[g]) + col] = verticalByte(g, bytesPerRow, bytesPerChar, height, firstCol[g] + col, page);
+					}
+				}
+			}
+		}
+		putWord(&entry[16], dataStart);
+		putWord(&entry[20], length);
+		unsigned index;
+		if (appendPack(pack, blob, dataStart + length, entry, &index) != 0) {return 1;}
+
+		if (fixed)
+		{
+			snprintf(upper, sizeof upper, "%sFONT", name);
+			for (char* c = upper; *c; c++) {*c = toupper((unsigned char)*c);}
+		}
+		printf("\n/*\n * Generated by tools/fontconv.c from %s, the font's number in %s. Do not edit by hand, re-run the converter instead.\n", path, pack);
+		printf(" * Load it with ST7565R_packFont(&pack, %s_PACK_INDEX, &stream, glyphTable, %s_GLYPHS, &font), then ST7565R_configureFont(font).\n */\n\n", upper, upper);
+		printf("#ifndef %s_PACK_H\n#define %s_PACK_H\n\n", upper, upper);
+		printf("/** Index of the font in %s. */\n#define %s_PACK_INDEX\t\t%u\n", pack, upper, index);
+		printf("/** Glyphs in the font, %s. */\n#define %s_GLYPHS\t\t\t%u\n", fixed ? "fixed width" : "entries its glyph table needs", upper, numGlyphs);
+		printf("/** Height of each glyph. */\n#define %s_HEIGHT\t\t\t%u\n", upper, height);
+		if (fixed) 	{printf("/** Width of each glyph. */\n#define %s_WIDTH\t\t\t%u\n", upper, width);}
+		else
+		{
+			printf("/** Rows above the baseline. */\n#define %s_ASCENT\t\t\t%u\n", upper, ascent);
+			printf("/** Widest advance of any glyph. */\n#define %s_MAXADVANCE\t\t%u\n", upper, maxAdvance);
+		}
+		printf("/** First character defined. */\n#define %s_FIRSTCHAR\t\t((uint8_t)%u)\n", upper, firstChar);
+		printf("/** Last character defined. */\n#define %s_LASTCHAR\t\t((uint8_t)%d)\n\n#endif\n", upper, lastChar);
+		fprintf(stderr, "%s: font %u of %s, %u glyphs, %u bytes\n", name, index, pack, numGlyphs, dataStart + length);
+		return 0;
+	}
+
+	printf("\n/*\n * %s\n *\n", file);
+	printf(" * Generated by tools/fontconv.c from %s. Do not edit by hand, re-run the converter instead.\n", path);
+	printf(" * Glyphs are vertically oriented (LSB is the top pixel), page by page, like the driver's bitmaps.\n */\n\n");
+	printf("#ifndef %s_H\n#define %s_H\n\n#include <stdint.h>\n\n", upper, upper);
+	printf("#define USING_FONT_%s_PROP\n\n", name);
+	printf("#if defined(USING_FONT_%s_PROP)\n", name);
+	printf("/** Height of each glyph bitmap. */\n#define %s_HEIGHT\t\t\t%u\n", upper, height);
+	printf("/** Rows above the baseline. */\n#define %s_ASCENT\t\t\t%u\n", upper, ascent);
+	printf("/** Rows below the baseline. */\n#define %s_DESCENT\t\t\t%u\n", upper, height - ascent);
+	printf("/** Widest advance of any glyph. */\n#define %s_MAXADVANCE\t\t%u\n", upper, maxAdvance);
+	printf("/** First character defined. */\n#define %s_FIRSTCHAR\t\t((uint8_t)%u)\n", upper, firstChar);
+	printf("/** Last character defined. */\n#define %s_LASTCHAR\t\t((uint8_t)%d)\n\n", upper, lastChar);
+
+	printf("/* Packed glyph data, %u bytes. Each glyph is <width> columns by %u pages. */\n", totalBytes, pages);
+	printf("static const uint8_t %sBitmaps[] = {\n", lower);
+	for (unsigned g = 0; g < numGlyphs; g++)
+	{
+		if (glyphWidth[g] == 0) {continue;}
+		printf("\t");
+		for (unsigned page = 0; page < pages; page++)
+		{
+			for (unsigned col = 0; col < glyphWidth[g]; col++)
+			{
+				printf("0x%02x, ", verticalByte(g, bytesPerRow, bytesPerChar, height, firstCol[g] + col, page));
+			}
+		}
+		printGlyphLabel(g, firstChar, lastChar);
+	}
+	if (totalBytes == 0) {printf("\t0x00\n");}
+	printf("};\n\n");
+
+	printf("/* Per-glyph offset into %sBitmaps, bitmap width and advance. */\n", lower);
+	printf("static const ST7565R_Glyph %sGlyphs[] = {\n", lower);
+	for (unsigned g = 0; g < numGlyphs; g++)
+	{
+		printf("\t{ .offset = %4u, .width = %2u, .advance = %2u },", offset[g], glyphWidth[g], advance[g]);
+		printGlyphLabel(g, firstChar, lastChar);
+	}
+	printf("};\n#endif\n\n#endif /* %s_H */\n", upper);
+	return 0;
+}
@@ -0,0 +1,257 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host benchmark for the ST7565R driver's grayscale mode (ST7565R_GRAYSCALE, see ST7565R_grayscaleTick()).
+		Paints a screen of the 4 gray levels with the driver, updates it, then runs ST7565R_grayscaleTick() for a few gray cycles
+		against the model of the controller in tools/host and counts the bytes each tick puts on the wire. From the busiest tick
+		of a steady cycle it works out the fastest tick rate an SPI clock can keep up with, and the gray refresh rate that gives
+		(a third of it). Below about 150 ticks a second (50 Hz gray) the shading flickers.
+		Along the way it checks what the driver claims: every tick's byte count has to match ST7565R_getGrayStats(), the display
+		has to stay on, over a cycle each pixel has to be dark in as many subframes as its level, and a tick while the driver is
+		locked (as when it interrupts an update) has to send nothing. Exits with 1 if not.
+		It includes ST7565R.c rather than linking it to reset the tick stats between screens, so don't add ST7565R.c to the gcc line.
+
+	Build & Run (host):
+		gcc -O2 -DST7565R_GRAYSCALE -DRETAIN_CURSCREEN -Itools/host -I. -o graybench tools/graybench.c tools/host/hostpanel.c bitmaps.c
+		./graybench
+		./graybench -c 8000000 chart.pgm
+
+	Arguments:
+		<image.pgm>			Optional PGM/PBM to measure, quantized to the 4 levels (black is level 3). Without one a set of
+							built in screens is measured
+		-c <hz>				Only this SPI clock (default: 1, 4, 8 and 20 MHz)
+
+	Built in screens:
+		bars				Four full height bands, one per level, like a gauge background
+		icons				Four 16x16 gray icons in a row, the rest black and white
+		chart				A 2 pixel gray trace over a level 1 area fill, like a strip chart
+		dither				Levels 1 and 2 in a checkerboard, the planes differ in every byte: the worst case
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "../ST7565R.c"
+#include "hostpanel.h"
+
+#ifndef ST7565R_GRAYSCALE
+#error "Build graybench with -DST7565R_GRAYSCALE -DRETAIN_CURSCREEN, see the top of tools/graybench.c"
+#endif
+
+#define CYCLES				4					// Gray cycles ticked per screen, the first one settles from what updateDisplay() sent
+
+static uint8_t levels[SCREENHEIGHT][SCREENWIDTH];
+
+static int readToken(FILE* file)
+{	// Next whitespace separated number in a PNM header or plain body, skipping # comments
+	int c = fgetc(file);
+	while (c != EOF && (isspace(c) || c == '#'))
+	{
+		if (c == '#') {while (c != EOF && c != '\n') {c = fgetc(file);}}
+		c = fgetc(file);
+	}
+	if (c == EOF || !isdigit(c)) {return -1;}
+	int value = 0;
+	while (c != EOF && isdigit(c))
+	{
+		value = (value * 10) + (c - '0');
+		c = fgetc(file);
+	}
+	return value;
+}
+
+static int readImage(const char* path)
+{	// Load a PGM (P2/P5) or PBM (P1/P4) into levels, cropped to the screen. Darker is a higher level
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) {return -1;}
+	int format = (fgetc(file) == 'P') ? fgetc(file) : 0;
+	int w = readToken(file), h = readToken(file);
+	int maxval = (format == '2' || format == '5') ? readToken(file) : 1;
+	if ((format < '1' || format > '5' || format == '3') || w <= 0 || h <= 0 || maxval <= 0) {fclose(file); return -1;}
+
+	memset(levels, 0, sizeof levels);
+	for (int y = 0; y < h; y++)
+	{
+		int bits = 0, byte = 0;
+		for (int x = 0; x < w; x++)
+		{
+			int level;
+			switch (format)
+			{
+			case '1':
+			{
+				int c = fgetc(file);
+				while (c != EOF && c != '0' && c != '1') {c = fgetc(file);}
+				level = (c == '1') ? 3 : 0;
+				break;
+			}
+			case '2': level = 3 - ((readToken(file) * 4) / (maxval + 1)); break;
+			case '4':
+				if (bits == 0) {byte = fgetc(file); bits = 8;}				// Rows are padded to whole bytes, MSB first
+				level = ((byte >> --bits) & 1) ? 3 : 0;
+				break;
+			default:
+			{
+				int value = (maxval > 255) ? ((fgetc(file) << 8) | fgetc(file)) : fgetc(file);
+				level = 3 - ((value * 4) / (maxval + 1));
+				break;
+			}
+			}
+			if (x < SCREENWIDTH && y < SCREENHEIGHT) {levels[y][x] = (uint8_t)level;}
+		}
+	}
+	fclose(file);
+	return 0;
+}
+
+static void buildScreen(const char* name)
+{	// The built in screens described at the top
+	unsigned width = SCREENWIDTH, height = SCREENHEIGHT;
+	memset(levels, 0, sizeof levels);
+	for (unsigned y = 0; y < height; y++)
+	{
+		for (unsigned x = 0; x < width; x++)
+		{
+			uint8_t level = 0;
+			if (strcmp(name, "bars") == 0) 		{level = (uint8_t)((x * 4) / width);}
+			else if (strcmp(name, "icons") == 0)
+			{	// Stripes of all four levels, in 16x16 boxes spaced 24 apart
+				unsigned icon = x / 24, ix = x % 24, iy = y - 4;
+				if (icon < 4 && ix < 16 && y >= 4 && iy < 16) {level = (uint8_t)(((ix / 4) + (iy / 4) + icon) % 4);}
+				else if (y == height - 1) 	{level = 3;}				// A black rule under them
+			}
+			else if (strcmp(name, "chart") == 0)
+			{
+				unsigned trace = (height / 2) + (unsigned)((height / 3) * ((x % 32) < 16 ? (x % 16) : 16 - (x % 16)) / 16);
+				if (y == trace || y == trace + 1) 	{level = 2;}
+				else if (y > trace + 1) 			{level = 1;}
+			}
+			else if (strcmp(name, "dither") == 0) {level = ((x + y) % 2) ? 1 : 2;}
+			levels[y][x] = level;
+		}
+	}
+}
+
+static int measure(const char* name, const uint32_t* clocks, unsigned numClocks)
+{	// Paint the levels, tick through a few cycles and check each tick, then the rates the busiest steady tick allows
+	ST7565R_clearScreen();
+	unsigned gray = 0;
+	for (unsigned y = 0; y < SCREENHEIGHT; y++)
+	{
+		for (unsigned x = 0; x < SCREENWIDTH; x++)
+		{
+			ST7565R_paintGrayPixel(levels[y][x], x, y);
+			gray += levels[y][x] == 1 || levels[y][x] == 2;
+		}
+	}
+	graySubframe = 1;						// Every screen starts the same, and the next subframe is the low plane with bytes to send
+	ST7565R_updateDisplay();
+	memset(&grayStats, 0, sizeof grayStats);
+
+	unsigned long before = hostPanelBytes();
+	ST7565R_lock();							// As if the tick interrupted an update, it has to keep off the wire
+	ST7565R_grayscaleTick();
+	ST7565R_unlock();
+	if (hostPanelBytes() != before || ST7565R_getGrayStats().skipped != 1)
+	{
+		printf("LOCK  %s: a tick during an update sent %lu bytes, %lu counted as skipped\n", name, hostPanelBytes() - before,
+				(unsigned long)ST7565R_getGrayStats().skipped);
+		return 1;
+	}
+	memset(&grayStats, 0, sizeof grayStats);
+
+	static uint8_t darkCount[SCREENHEIGHT][SCREENWIDTH];
+	unsigned long ticks[ST7565R_GRAY_SUBFRAMES], busiest = 0;
+	for (unsigned tick = 0; tick < CYCLES * ST7565R_GRAY_SUBFRAMES; tick++)
+	{
+		unsigned subframe 	= tick % ST7565R_GRAY_SUBFRAMES;
+		unsigned long before = hostPanelBytes();
+		ST7565R_grayscaleTick();
+		unsigned long sent 	= hostPanelBytes() - before;
+		ST7565R_GrayStats stats = ST7565R_getGrayStats();
+
+		if (stats.lastBytes != sent)
+		{
+			printf("COUNT %s tick %u: %lu bytes sent, ST7565R_getGrayStats() says %lu\n", name, tick, sent, (unsigned long)stats.lastBytes);
+			return 1;
+		}
+		if (!hostPanel.displayOn || hostPanel.strayBytes != 0)
+		{
+			printf("WIRE  %s tick %u: %s\n", name, tick, hostPanel.displayOn ? "bytes sent with Chip Select high" : "display left off");
+			return 1;
+		}
+		if (tick < ST7565R_GRAY_SUBFRAMES) {continue;}
+
+		if (subframe == 0) {memset(darkCount, 0, sizeof darkCount);}
+		for (unsigned y = 0; y < SCREENHEIGHT; y++)
+		{
+			for (unsigned x = 0; x < SCREENWIDTH; x++) {darkCount[y][x] += (hostPanel.ram[y / 8][x] >> (y % 8)) & 1;}
+		}
+		if (subframe == ST7565R_GRAY_SUBFRAMES - 1)
+		{	// A whole cycle on the panel, level n has to have been dark in n subframes
+			for (unsigned y = 0; y < SCREENHEIGHT; y++)
+			{
+				for (unsigned x = 0; x < SCREENWIDTH; x++)
+				{
+					if (darkCount[y][x] == levels[y][x]) {continue;}
+					printf("LEVEL %s (%u,%u): level %u was dark in %u of %u subframes\n", name, x, y, levels[y][x], darkCount[y][x], ST7565R_GRAY_SUBFRAMES);
+					return 1;
+				}
+			}
+		}
+		ticks[subframe] = sent;
+		if (sent > busiest) {busiest = sent;}
+	}
+
+	ST7565R_GrayStats stats = ST7565R_getGrayStats();
+	printf("%s: %u gray pixels, ticks send", name, gray);
+	for (unsigned subframe = 0; subframe < ST7565R_GRAY_SUBFRAMES; subframe++) {printf(" %lu", ticks[subframe]);}
+	printf(" bytes (%lu at most over %lu ticks)\n", (unsigned long)stats.maxBytes, (unsigned long)stats.ticks);
+	for (unsigned c = 0; c < numClocks; c++)
+	{
+		if (busiest == 0) {printf("\t%8lu Hz SPI   nothing to send, any tick rate\n", (unsigned long)clocks[c]); continue;}
+		unsigned long tickHz = clocks[c] / (8 * busiest);
+		printf("\t%8lu Hz SPI   %6lu ticks/s   %5lu Hz gray%s\n", (unsigned long)clocks[c], tickHz, tickHz / ST7565R_GRAY_SUBFRAMES,
+				(tickHz < 150) ? "   (flickers)" : "");
+	}
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t clocks[4] = {1000000, 4000000, 8000000, 20000000};
+	unsigned numClocks = 4;
+	int option;
+	while ((option = getopt(argc, argv, "c:")) != -1)
+	{
+		switch (option)
+		{
+		case 'c': clocks[0] 	= (uint32_t)strtoul(optarg, NULL, 0); numClocks = 1; break;
+		default:  optind 		= argc + 1; break;
+		}
+	}
+	if (argc - optind > 1 || clocks[0] == 0)
+	{
+		fprintf(stderr, "usage: %s [-c spiHz] [image.pgm]\n", argv[0]);
+		return 2;
+	}
+
+	ST7565R_setup();
+	if (argc - optind == 1)
+	{
+		if (readImage(argv[optind]) != 0) {fprintf(stderr, "graybench: can't read %s\n", argv[optind]); return 2;}
+		return measure(argv[optind], clocks, numClocks);
+	}
+	const char* screens[] = {"bars", "icons", "chart", "dither"};
+	for (unsigned i = 0; i < sizeof screens / sizeof screens[0]; i++)
+	{
+		buildScreen(screens[i]);
+		if (measure(screens[i], clocks, numClocks) != 0) {return 1;}
+	}
+	return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host stress test for the ST7565R driver's frame handoff (ST7565R_FRAME_HANDOFF, see ST7565R_flushFrame()). Two drawing
+		threads share the driver through a PTHREAD_MUTEX_RECURSIVE mutex given to ST7565R_setLockHooks(), the way two RTOS tasks
+		would, while a display thread calls ST7565R_flushFrame() as fast as it can into the model of the controller in tools/host.
+		Each frame is painted a page at a time in one byte, its tag, yielding between pages, then published by ST7565R_updateDisplay()
+		with the lock still held (so it nests). After every frame the display thread sends it checks the whole display RAM holds
+		a single tag: anything else is a torn frame, part of one and part of another. When the drawing is done the newest frame
+		has to be the one on the display. Exits with 1 on a torn or a stale frame.
+		Build it with -fsanitize=thread too, ThreadSanitizer then reports any access to the frames that the handoff doesn't order.
+
+	Build & Run (host):
+		gcc -O2 -g -DST7565R_FRAME_HANDOFF -pthread -fsanitize=thread -Itools/host -I. -o handoffstress tools/handoffstress.c tools/host/hostpanel.c ST7565R.c bitmaps.c
+		./handoffstress
+		./handoffstress -f 100000
+		Drop -fsanitize=thread for a faster run with more frames
+
+	Arguments:
+		-f <frames>			Frames each drawing thread paints (default 20000)
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "ST7565R.h"
+#include "hostpanel.h"
+
+#ifndef ST7565R_FRAME_HANDOFF
+#error "Build handoffstress with -DST7565R_FRAME_HANDOFF, see the top of tools/handoffstress.c"
+#endif
+#if defined(ST7565R_ROTATE_90) || defined(ST7565R_ROTATE_270)
+#error "handoffstress tags frames with whole page bytes, build it without rotation"
+#endif
+
+#define DRAWERS				2
+
+static pthread_mutex_t driverMutex;
+static unsigned framesEach = 20000;
+static uint8_t lastTag = 0;						// Tag of the newest published frame, only touched with the lock held
+static atomic_bool drawing = true;
+
+static unsigned long framesSent = 0;			// Display thread's counts
+static unsigned long tornFrames = 0;
+
+static void lockDriver(void* context)
+{
+	pthread_mutex_lock((pthread_mutex_t*)context);
+}
+
+static void unlockDriver(void* context)
+{
+	pthread_mutex_unlock((pthread_mutex_t*)context);
+}
+
+static void* drawFrames(void* argument)
+{	// Paint whole frames in one tag byte, giving the other drawer and the display thread every chance to cut in between pages
+	(void)argument;
+	static uint8_t pageBytes[SCREENWIDTH];
+	for (unsigned frame = 0; frame < framesEach; frame++)
+	{
+		ST7565R_lock();
+		uint8_t tag = (uint8_t)((lastTag % 255) + 1);	// Never 0, which is what the display starts with
+		for (unsigned i = 0; i < SCREENWIDTH; i++) {pageBytes[i] = tag;}
+		for (unsigned page = 0; page < SCREENPAGES; page++)
+		{
+			ST7565R_paintBitmap(pageBytes, 0, page * 8, SCREENWIDTH, 8);
+			sched_yield();
+		}
+		lastTag = tag;
+		ST7565R_updateDisplay();						// Takes the lock again
+		ST7565R_unlock();
+	}
+	return NULL;
+}
+
+static int checkPanel(uint8_t* tag)
+{	// Whether every byte of the display RAM the screen shows is the same one, and which
+	*tag = hostPanel.ram[0][0];
+	for (unsigned page = 0; page < SCREENPAGES; page++)
+	{
+		for (unsigned column = 0; column < SCREENWIDTH; column++)
+		{
+			if (hostPanel.ram[page][column] != *tag) {return 0;}
+		}
+	}
+	return 1;
+}
+
+static void* sendFrames(void* argument)
+{	// The display task: send whatever's newest and check it arrived whole
+	(void)argument;
+	uint8_t tag;
+	while (atomic_load(&drawing))
+	{
+		if (!ST7565R_flushFrame()) {sched_yield(); continue;}
+		framesSent++;
+		if (!checkPanel(&tag))
+		{
+			if (tornFrames++ == 0) {printf("TORN  frame %lu: page 0 starts with %u, the display isn't one frame\n", framesSent, tag);}
+		}
+	}
+	if (ST7565R_flushFrame()) {framesSent++;}			// The last one published after the loop's last look
+	return NULL;
+}
+
+int main(int argc, char** argv)
+{
+	int option;
+	while ((option = getopt(argc, argv, "f:")) != -1)
+	{
+		switch (option)
+		{
+		case 'f': framesEach 	= (unsigned)strtoul(optarg, NULL, 0); break;
+		default:  optind 		= argc + 1; break;
+		}
+	}
+	if (argc != optind || framesEach == 0)
+	{
+		fprintf(stderr, "usage: %s [-f frames]\n", argv[0]);
+		return 2;
+	}
+
+	pthread_mutexattr_t attributes;
+	pthread_mutexattr_init(&attributes);
+	pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&driverMutex, &attributes);
+	pthread_mutexattr_destroy(&attributes);
+	ST7565R_setLockHooks(lockDriver, unlockDriver, &driverMutex);
+	ST7565R_setup();									// Before the threads, it sends the first frame itself
+
+	pthread_t drawers[DRAWERS], display;
+	if (pthread_create(&display, NULL, sendFrames, NULL) != 0) {fprintf(stderr, "handoffstress: can't start the display thread\n"); return 2;}
+	for (unsigned i = 0; i < DRAWERS; i++)
+	{
+		if (pthread_create(&drawers[i], NULL, drawFrames, NULL) != 0) {fprintf(stderr, "handoffstress: can't start a drawing thread\n"); return 2;}
+	}
+	for (unsigned i = 0; i < DRAWERS; i++) {pthread_join(drawers[i], NULL);}
+	atomic_store(&drawing, false);
+	pthread_join(display, NULL);
+
+	uint8_t tag;
+	int whole = checkPanel(&tag);
+	int stale = !whole || tag != lastTag;
+	printf("%u frames drawn, %lu sent, %lu skipped for a newer one\n", DRAWERS * framesEach, framesSent, DRAWERS * framesEach - framesSent);
+	printf("%lu torn frames, display %s the newest frame\n", tornFrames, stale ? "DOESN'T show" : "shows");
+	if (hostPanel.strayBytes != 0) {printf("%lu bytes sent with Chip Select high\n", hostPanel.strayBytes);}
+	return (tornFrames != 0 || stale || hostPanel.strayBytes != 0) ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host HAL for the ST7565R driver, see tools/host/main.h and hostpanel.h. Link it with ST7565R.c and a check from tools/.
+ ***********************************************************************************************************************************************************************
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+
+#include "main.h"
+#include "spi.h"
+#include "hostpanel.h"
+
+GPIO_TypeDef hostGpio;
+TIM_TypeDef hostTim2;
+SPI_HandleTypeDef hspi2;
+HostPanel hostPanel = {.chipSelect = 1};
+
+static void command(HostPanel* lcd, uint8_t byte)
+{	// The parts of the command set that change what ends up in or on the RAM, as in tools/tracereplay.c
+	if (lcd->pendingArgument) {lcd->pendingArgument = 0; return;}
+	if ((byte & 0xF0) == 0xB0) 		{if ((byte & 0x0F) < HOSTPANEL_PAGES) {lcd->page = byte & 0x0F;}}
+	else if ((byte & 0xF0) == 0x10) {lcd->column = ((byte & 0x0F) << 4) | (lcd->column & 0x0F);}
+	else if ((byte & 0xF0) == 0x00) {lcd->column = (lcd->column & 0xF0) | (byte & 0x0F);}
+	else switch (byte)
+	{
+	case 0xAE: lcd->displayOn = 0; break;
+	case 0xAF: lcd->displayOn = 1; break;
+	case 0xE0: lcd->readModifyWrite = 1; lcd->savedColumn = lcd->column; break;
+	case 0xEE: if (lcd->readModifyWrite) {lcd->column = lcd->savedColumn;} lcd->readModifyWrite = 0; break;
+	case 0xE2: lcd->page = 0; lcd->column = 0; lcd->readModifyWrite = 0; break;
+	case 0x81: case 0xF8: case 0xAC: case 0xAD: lcd->pendingArgument = 1; break;	// Volume, booster ratio, static indicator off/on
+	default: break;
+	}
+}
+
+void hostPanelReset(void)
+{
+	memset(&hostPanel, 0, sizeof(hostPanel));
+	hostPanel.chipSelect = 1;
+}
+
+unsigned long hostPanelBytes(void)
+{
+	return hostPanel.commandBytes + hostPanel.dataBytes;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, int state)
+{
+	if (state) 	{port->ODR |= pin;}
+	else 		{port->ODR &= ~(uint32_t)pin;}
+	if (pin == NHD_CS_Pin) 	{hostPanel.chipSelect = state;}
+	if (pin == NHD_A0_Pin) 	{hostPanel.a0 = state;}
+}
+
+void HAL_Delay(uint32_t delay)
+{	// Reset and power up waits don't matter to the model
+	(void)delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)((uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u);
+}
+
+int HAL_SPI_Transmit(SPI_HandleTypeDef* spi, uint8_t* data, uint16_t size, uint32_t timeout)
+{
+	(void)timeout;
+	spi->transfers++;
+	for (unsigned i = 0; i < size; i++)
+	{
+		if (hostPanel.chipSelect) {hostPanel.strayBytes++; continue;}
+		if (hostPanel.a0)
+		{	// Written at the current column, which then moves right (and stops past the last one)
+			hostPanel.dataBytes++;
+			if (hostPanel.column < HOSTPANEL_COLUMNS) {hostPanel.ram[hostPanel.page][hostPanel.column++] = data[i];}
+		}
+		else
+		{
+			hostPanel.commandBytes++;
+			command(&hostPanel, data[i]);
+		}
+	}
+	return 0;
+}
+
+int HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* spi, uint8_t* data, uint16_t size)
+{
+	return HAL_SPI_Transmit(spi, data, size, HAL_MAX_DELAY);
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef* spi)
+{
+	(void)spi;
+	return HAL_SPI_STATE_READY;
+}
@@ -0,0 +1,38 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Model of the ST7565R controller behind the host HAL in tools/host/main.h and spi.h. Every byte the driver sends is decoded
+		like tools/tracereplay.c does, with A0 picking command or data, so a host check can compare the display RAM against
+		the driver's buffers and count what went over the wire.
+ ***********************************************************************************************************************************************************************
+ */
+
+#ifndef HOST_PANEL_H
+#define HOST_PANEL_H
+
+#include <stdint.h>
+
+#define HOSTPANEL_PAGES			9				// 8 pages and the icon page
+#define HOSTPANEL_COLUMNS		132
+
+typedef struct {
+	uint8_t ram[HOSTPANEL_PAGES][HOSTPANEL_COLUMNS];
+	unsigned page;
+	unsigned column;
+	unsigned savedColumn;						// Read-modify-write
+	int readModifyWrite;
+	int pendingArgument;						// Second byte of a two byte command still to come
+	int displayOn;
+	int chipSelect;								// Pin levels, Chip Select idles high
+	int a0;
+	unsigned long commandBytes;
+	unsigned long dataBytes;
+	unsigned long strayBytes;					// Sent with Chip Select high, which the real controller ignores
+} HostPanel;
+
+extern HostPanel hostPanel;
+
+void hostPanelReset			(void);			// Blank RAM and zeroed counts, as after power up
+unsigned long hostPanelBytes(void);			// Commands and data sent so far
+
+#endif
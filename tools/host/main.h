@@ -0,0 +1,52 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host stand in for the STM32 CubeMX main.h the driver includes, with just what ST7565R.h and ST7565R.c use: the NHD_ pins,
+		TIM2's capture/compare register for the backlight and the HAL GPIO, delay and tick calls. They're implemented in
+		tools/host/hostpanel.c, which puts what the driver sends into a model of the controller.
+		Used by the host checks in tools/ (see the top of each), build them with -Itools/host so this is found before any other main.h
+ ***********************************************************************************************************************************************************************
+ */
+
+#ifndef HOST_MAIN_H
+#define HOST_MAIN_H
+
+#include <stddef.h>						// The HAL headers pull these in on the board
+#include <stdint.h>
+
+typedef struct {
+	uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef struct {
+	volatile uint32_t CCR1;
+} TIM_TypeDef;
+
+extern GPIO_TypeDef hostGpio;
+extern TIM_TypeDef hostTim2;
+
+#define TIM2					(&hostTim2)
+#define HAL_MAX_DELAY			0xFFFFFFFFU
+
+#define NHD_LED_GPIO_Port		(&hostGpio)
+#define NHD_CS_GPIO_Port		(&hostGpio)
+#define NHD_RES_GPIO_Port		(&hostGpio)
+#define NHD_A0_GPIO_Port		(&hostGpio)
+#define NHD_SDA_GPIO_Port		(&hostGpio)
+#define NHD_SCL_GPIO_Port		(&hostGpio)
+#define NHD_LED_Pin				0x0001
+#define NHD_CS_Pin				0x0002
+#define NHD_RES_Pin				0x0004
+#define NHD_A0_Pin				0x0008
+#define NHD_SDA_Pin				0x0010
+#define NHD_SCL_Pin				0x0020
+
+void HAL_GPIO_WritePin		(GPIO_TypeDef* port, uint16_t pin, int state);
+void HAL_Delay				(uint32_t delay);
+uint32_t HAL_GetTick		(void);				// Microseconds on the host, so ST7565R_trace_clock() can time single paints
+
+static inline uint32_t __get_PRIMASK(void)		{return 0;}		// One core and no interrupts, critical sections are free
+static inline void __set_PRIMASK(uint32_t mask)	{(void)mask;}
+static inline void __disable_irq(void)			{}
+
+#endif
@@ -0,0 +1,29 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host stand in for the STM32 CubeMX spi.h, see tools/host/main.h. Transfers go straight into the model of the controller
+		in tools/host/hostpanel.c, DMA ones included, so a DMA transfer has finished by the time HAL_SPI_Transmit_DMA() returns.
+ ***********************************************************************************************************************************************************************
+ */
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t transfers;
+} SPI_HandleTypeDef;
+
+typedef enum {
+	HAL_SPI_STATE_READY = 1,
+	HAL_SPI_STATE_BUSY_TX = 3
+} HAL_SPI_StateTypeDef;
+
+extern SPI_HandleTypeDef hspi2;
+
+int HAL_SPI_Transmit						(SPI_HandleTypeDef* spi, uint8_t* data, uint16_t size, uint32_t timeout);
+int HAL_SPI_Transmit_DMA					(SPI_HandleTypeDef* spi, uint8_t* data, uint16_t size);
+HAL_SPI_StateTypeDef HAL_SPI_GetState		(SPI_HandleTypeDef* spi);
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host check for the ST7565R driver's rasterizers (ST7565R_SELF_CHECK, see ST7565R_selfCheck()). Builds the driver
+		against the host HAL in tools/host, where SPI goes into a model of the controller and ST7565R_trace_clock() counts
+		microseconds, and runs ST7565R_selfCheck() over a fixed set of seeds with the fixed width and the proportional font.
+		Prints each primitive's runs, mismatches and how many times faster the paint functions are than the pixel at a time
+		reference, and exits with 1 on any mismatch along with the seed and round to reproduce it. A single pixel takes less
+		than the microsecond clock can see, so its speedup is mostly rounding.
+		Run it after changing a rasterizer, in each orientation and paint mode the change touches. Firmware builds leave
+		ST7565R_SELF_CHECK commented out and never see this.
+
+	Build & Run (host):
+		gcc -O2 -DST7565R_SELF_CHECK -Itools/host -I. -o rastercheck tools/rastercheck.c tools/host/hostpanel.c ST7565R.c bitmaps.c
+		./rastercheck
+		./rastercheck -r 100000 -s 7
+		Add -DST7565R_ROTATE_90, -DST7565R_ROTATE_270 or -DPAINT_IMMEDIATELY to the gcc line to check those builds
+
+	Arguments:
+		-r <rounds>			Primitives painted per seed and font (default 20000)
+		-s <seed>			Only this seed (default: the built in set)
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "ST7565R.h"
+
+#ifndef ST7565R_SELF_CHECK
+#error "Build rastercheck with -DST7565R_SELF_CHECK, see the top of tools/rastercheck.c"
+#endif
+
+static const char* primitiveNames[CHECK_PRIMITIVES] = {"pixel", "rectangle", "bitmap", "bitmap scaled", "string", "string scaled"};
+
+static int check(const char* fontName, uint32_t rounds, const uint32_t* seeds, unsigned numSeeds)
+{	// Every seed with the current font, totals per primitive. Returns how many seeds mismatched
+	ST7565R_CheckResult totals[CHECK_PRIMITIVES] = {{0}};
+	int failed = 0;
+	for (unsigned s = 0; s < numSeeds; s++)
+	{
+		ST7565R_CheckStats stats = ST7565R_selfCheck(rounds, seeds[s]);
+		for (unsigned p = 0; p < CHECK_PRIMITIVES; p++)
+		{
+			totals[p].runs 				+= stats.primitive[p].runs;
+			totals[p].mismatches 		+= stats.primitive[p].mismatches;
+			totals[p].fastTicks 		+= stats.primitive[p].fastTicks;
+			totals[p].referenceTicks 	+= stats.primitive[p].referenceTicks;
+		}
+		if (stats.firstFailure != UINT32_MAX)
+		{
+			printf("MISMATCH  %s font, seed %lu, first at round %lu\n", fontName, (unsigned long)seeds[s], (unsigned long)stats.firstFailure);
+			failed++;
+		}
+	}
+
+	printf("%s font, %lu rounds x %u seeds\n", fontName, (unsigned long)rounds, numSeeds);
+	for (unsigned p = 0; p < CHECK_PRIMITIVES; p++)
+	{
+		printf("\t%-14s %8lu runs %6lu mismatches", primitiveNames[p], (unsigned long)totals[p].runs, (unsigned long)totals[p].mismatches);
+		if (totals[p].fastTicks != 0) 	{printf("   %6.1fx faster\n", (double)totals[p].referenceTicks / totals[p].fastTicks);}
+		else 							{printf("   (too quick to time)\n");}
+	}
+	return failed;
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t seeds[] = {1, 2, 7, 1234, 0x5EED, 0xC0FFEE, 0x2545F491, 0xFFFFFFFF};
+	unsigned numSeeds = sizeof seeds / sizeof seeds[0];
+	uint32_t rounds = 20000;
+	int option;
+	while ((option = getopt(argc, argv, "r:s:")) != -1)
+	{
+		switch (option)
+		{
+		case 'r': rounds 	= (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 's': seeds[0] 	= (uint32_t)strtoul(optarg, NULL, 0); numSeeds = 1; break;
+		default:  optind 	= argc + 1; break;
+		}
+	}
+	if (argc != optind || rounds == 0)
+	{
+		fprintf(stderr, "usage: %s [-r rounds] [-s seed]\n", argv[0]);
+		return 2;
+	}
+
+	ST7565R_setup();
+	int failed = 0;
+	ST7565R_configureFontDefault();
+	failed += check("fixed width", rounds, seeds, numSeeds);
+	ST7565R_configureFontProportional();
+	failed += check("proportional", rounds, seeds, numSeeds);
+	return (failed != 0) ? 1 : 0;
+}
@@ -0,0 +1,232 @@
+
+/*
+ ***********************************************************************************************************************************************************************
+	Description:
+		Host replayer for wire traces recorded by the ST7565R driver (ST7565R_TRACE, see ST7565R_setTraceSink()).
+		Feeds every recorded byte into a model of the ST7565R controller and reports the final display RAM and what the
+		traffic cost. Given two traces it also checks they leave the same image, so a change to how the driver flushes
+		can be shown to paint exactly the same thing with fewer bytes.
+
+	Build & Run (host):
+		gcc -O2 -o tracereplay tools/tracereplay.c
+		./tracereplay -a field.trace
+		./tracereplay -c 8000000 before.trace after.trace
+
+	Arguments:
+		<trace>				Trace to replay
+		<other trace>		Optional second trace. Exits with 1 if its final image differs from the first one's
+		-c <hz>				SPI clock used for the wire time (default 4000000, like ST7565R_SPI_CLOCK_HZ)
+		-w <width>			Columns of the image shown and compared (default 128)
+		-h <height>			Rows of the image shown and compared (default 32)
+		-a					Print the final image as text
+		-o <file.pbm>		Write the final image of the first trace as a PBM
+
+	Trace format (all little endian):
+		Header		'S' '7' 'T' 'R', version (1), trace clock in Hz (uint32)
+		Records		One per Chip Select low period, split every 64 bytes:
+					a control byte: bit 7 A0 (1 data, 0 command), bit 6 set when the record carries on the previous
+					one's Chip Select period (no CS edges between them), bits 0 - 5 the byte count - 1.
+					Then the clock ticks from the previous record's CS falling edge to this one's (LEB128, 0 when
+					carrying on), then the bytes themselves
+		The image is in display RAM order, column by page the way the driver addresses it, before ADC and COM flips.
+ ***********************************************************************************************************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#define RAM_PAGES			9					// 8 pages and the icon page
+#define RAM_COLUMNS			132
+#define TRACE_VERSION		1
+
+typedef struct {
+	uint8_t ram[RAM_PAGES][RAM_COLUMNS];
+	unsigned page;
+	unsigned column;
+	unsigned savedColumn;						// Read-modify-write
+	int readModifyWrite;
+	int pendingArgument;						// Second byte of a two byte command still to come
+	int displayOn;
+	int allPointsOn;
+	int startLine;
+} Controller;
+
+typedef struct {
+	uint32_t clockHz;
+	uint64_t ticks;								// From the first CS falling edge to the last
+	unsigned long records;
+	unsigned long windows;						// Chip Select low periods
+	unsigned long commandBytes;
+	unsigned long dataBytes;
+	unsigned long unchangedBytes;				// Data bytes that wrote what the RAM already held
+	unsigned long droppedBytes;					// Data bytes past the last column
+	unsigned long displayOffs;
+	unsigned long sleeps;						// Entries into power save (ALL_POINTS_ON while the display is off)
+} Stats;
+
+static void command(Controller* lcd, Stats* stats, uint8_t byte)
+{	// The parts of the command set that change what ends up in or on the RAM
+	if (lcd->pendingArgument) {lcd->pendingArgument = 0; return;}
+	if ((byte & 0xF0) == 0xB0) 		{if ((byte & 0x0F) < RAM_PAGES) {lcd->page = byte & 0x0F;}}
+	else if ((byte & 0xF0) == 0x10) {lcd->column = ((byte & 0x0F) << 4) | (lcd->column & 0x0F);}
+	else if ((byte & 0xF0) == 0x00) {lcd->column = (lcd->column & 0xF0) | (byte & 0x0F);}
+	else if ((byte & 0xC0) == 0x40) {lcd->startLine = byte & 0x3F;}
+	else switch (byte)
+	{
+	case 0xAE: lcd->displayOn = 0; stats->displayOffs++; break;
+	case 0xAF: lcd->displayOn = 1; break;
+	case 0xA4: lcd->allPointsOn = 0; break;
+	case 0xA5: if (!lcd->displayOn && !lcd->allPointsOn) {stats->sleeps++;} lcd->allPointsOn = 1; break;
+	case 0xE0: lcd->readModifyWrite = 1; lcd->savedColumn = lcd->column; break;
+	case 0xEE: if (lcd->readModifyWrite) {lcd->column = lcd->savedColumn;} lcd->readModifyWrite = 0; break;
+	case 0xE2: lcd->page = 0; lcd->column = 0; lcd->startLine = 0; lcd->readModifyWrite = 0; break;
+	case 0x81: case 0xF8: case 0xAC: case 0xAD: lcd->pendingArgument = 1; break;	// Volume, booster ratio, static indicator off/on
+	default: break;
+	}
+}
+
+static void data(Controller* lcd, Stats* stats, uint8_t byte)
+{	// Written at the current column, which then moves right (and stops past the last one)
+	if (lcd->column >= RAM_COLUMNS) {stats->droppedBytes++; return;}
+	if (lcd->ram[lcd->page][lcd->column] == byte) {stats->unchangedBytes++;}
+	lcd->ram[lcd->page][lcd->column++] = byte;
+}
+
+static int replay(const char* path, Controller* lcd, Stats* stats)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) {fprintf(stderr, "tracereplay: can't read %s\n", path); return -1;}
+	memset(lcd, 0, sizeof(Controller));
+	memset(stats, 0, sizeof(Stats));
+
+	uint8_t header[9];
+	if (fread(header, 1, sizeof header, file) != sizeof header || memcmp(header, "S7TR", 4) != 0 || header[4] != TRACE_VERSION)
+	{
+		fprintf(stderr, "tracereplay: %s isn't a version %d trace\n", path, TRACE_VERSION);
+		fclose(file);
+		return -1;
+	}
+	stats->clockHz = header[5] | (header[6] << 8) | (header[7] << 16) | ((uint32_t)header[8] << 24);
+
+	int control;
+	while ((control = fgetc(file)) != EOF)
+	{
+		uint64_t delta = 0;
+		int shift = 0, c;
+		do
+		{	// LEB128: 7 bits at a time, low bits first
+			c = fgetc(file);
+			if (c == EOF) {break;}
+			delta |= (uint64_t)(c & 0x7F) << shift;
+			shift += 7;
+		} while (c & 0x80);
+
+		unsigned count = (control & 0x3F) + 1;
+		uint8_t bytes[64];
+		if (c == EOF || fread(bytes, 1, count, file) != count)
+		{
+			fprintf(stderr, "tracereplay: %s is cut short after %lu records\n", path, stats->records);
+			break;
+		}
+		stats->records++;
+		if (!(control & 0x40)) {stats->windows++;}
+		if (stats->records > 1) {stats->ticks += delta;}
+		for (unsigned i = 0; i < count; i++)
+		{
+			if (control & 0x80) {stats->dataBytes++;	data(lcd, stats, bytes[i]);}
+			else 				{stats->commandBytes++;	command(lcd, stats, bytes[i]);}
+		}
+	}
+	fclose(file);
+	return 0;
+}
+
+static int pixel(const Controller* lcd, unsigned x, unsigned y)
+{
+	return (lcd->ram[y / 8][x] >> (y % 8)) & 1;
+}
+
+static void printStats(const char* path, const Stats* stats, uint32_t spiHz)
+{
+	unsigned long total = stats->commandBytes + stats->dataBytes;
+	printf("%s\n", path);
+	printf("\tbytes         %lu (%lu command, %lu data, %lu data unchanged, %lu dropped)\n",
+			total, stats->commandBytes, stats->dataBytes, stats->unchangedBytes, stats->droppedBytes);
+	printf("\trecords       %lu in %lu chip select periods, %lu display offs, %lu sleeps\n", stats->records, stats->windows, stats->displayOffs, stats->sleeps);
+	printf("\twire time     %.1f us at %lu Hz\n", (total * 8.0 * 1000000.0) / spiHz, (unsigned long)spiHz);
+	if (stats->clockHz != 0) {printf("\ttraced time   %.1f us\n", (stats->ticks * 1000000.0) / stats->clockHz);}
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t spiHz = 4000000;
+	unsigned width = 128, height = 32;
+	int ascii = 0, option;
+	const char* pbm = NULL;
+	while ((option = getopt(argc, argv, "c:w:h:ao:")) != -1)
+	{
+		switch (option)
+		{
+		case 'c': spiHz 	= (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 'w': width 	= (unsigned)atoi(optarg); break;
+		case 'h': height 	= (unsigned)atoi(optarg); break;
+		case 'a': ascii 	= 1; break;
+		case 'o': pbm 		= optarg; break;
+		default:  optind 	= argc + 1; break;
+		}
+	}
+	if (argc - optind < 1 || argc - optind > 2 || spiHz == 0)
+	{
+		fprintf(stderr, "usage: %s [-c spiHz] [-w width] [-h height] [-a] [-o image.pbm] <trace> [other trace]\n", argv[0]);
+		return 2;
+	}
+	if (width > RAM_COLUMNS) 		{width = RAM_COLUMNS;}
+	if (height > RAM_PAGES * 8) 	{height = RAM_PAGES * 8;}
+
+	static Controller lcd[2];
+	Stats stats[2];
+	int traces = argc - optind;
+	for (int t = 0; t < traces; t++)
+	{
+		if (replay(argv[optind + t], &lcd[t], &stats[t]) != 0) {return 2;}
+		printStats(argv[optind + t], &stats[t], spiHz);
+	}
+
+	if (ascii)
+	{
+		for (unsigned y = 0; y < height; y++)
+		{
+			for (unsigned x = 0; x < width; x++) {putchar(pixel(&lcd[0], x, y) ? '#' : '.');}
+			putchar('\n');
+		}
+	}
+	if (pbm != NULL)
+	{
+		FILE* file = fopen(pbm, "w");
+		if (file == NULL) {fprintf(stderr, "tracereplay: can't write %s\n", pbm); return 2;}
+		fprintf(file, "P1\n%u %u\n", width, height);
+		for (unsigned y = 0; y < height; y++)
+		{
+			for (unsigned x = 0; x < width; x++) {fputc(pixel(&lcd[0], x, y) ? '1' : '0', file);}
+			fputc('\n', file);
+		}
+		fclose(file);
+	}
+
+	if (traces == 2)
+	{
+		unsigned long differ = 0;
+		for (unsigned y = 0; y < height; y++)
+		{
+			for (unsigned x = 0; x < width; x++) {differ += pixel(&lcd[0], x, y) != pixel(&lcd[1], x, y);}
+		}
+		long saved = (long)(stats[0].commandBytes + stats[0].dataBytes) - (long)(stats[1].commandBytes + stats[1].dataBytes);
+		if (differ != 0) 	{printf("images differ in %lu pixels\n", differ);}
+		else 				{printf("images match, the second trace sends %ld fewer bytes\n", saved);}
+		return (differ != 0) ? 1 : 0;
+	}
+	return 0;
+}